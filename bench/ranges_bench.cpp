@@ -0,0 +1,554 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   ranges_bench.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 11:20 AM
+ */
+
+// Microbenchmarks comparing range wrappers with the equivalent hand-written loops.
+//
+// Each scenario is run over `std::vector<int>`, `std::vector<std::string>` and
+// `std::vector<my_movable>` sources for chains of depth 1-8. Results are written
+// as tab-separated lines:
+//
+//     name  depth  elements  ns_per_elem  melems_per_sec  raw_ns_per_elem  penalty
+//
+// where `penalty` is a ratio of the range time to the raw loop time, median
+// of the specified number of runs (each run takes the best of `repeats` measurements).
+// When baseline file (produced on the same host) is specified, penalties are compared
+// with the baseline ones, growth above both the relative tolerance and the absolute
+// noise floor is reported as a regression. Regressions are only printed unless `--strict`
+// is specified, in that case process exits with non-zero code.
+//
+// Usage:
+//
+//     staticlib_ranges_bench [--size N] [--repeats N] [--runs N] [--output path]
+//                            [--baseline path] [--tolerance 0.5] [--noise-floor 0.5]
+//                            [--strict]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges.hpp"
+
+#include "domain_classes.hpp"
+
+namespace { // anonymous
+
+const int max_depth = 8;
+
+// element operations
+
+int make_elem(int val, int*) {
+    return val;
+}
+
+std::string make_elem(int val, std::string*) {
+    auto st = std::string("record-000000000-payload");
+    auto num = std::to_string(val);
+    std::copy(num.begin(), num.end(), st.begin() + 16 - num.length());
+    return st;
+}
+
+my_movable make_elem(int val, my_movable*) {
+    return my_movable(val);
+}
+
+int mutate(int val) {
+    return val + 1;
+}
+
+std::string mutate(std::string val) {
+    val[0] = static_cast<char>(val[0] ^ 1);
+    return val;
+}
+
+my_movable mutate(my_movable val) {
+    val.set_val(val.get_val() + 1);
+    return val;
+}
+
+uint64_t key(const int& val) {
+    return static_cast<uint64_t>(val);
+}
+
+uint64_t key(const std::string& val) {
+    return static_cast<uint64_t>(val[0]) * 1000 + static_cast<uint64_t>(val[13] - '0') * 100 +
+            static_cast<uint64_t>(val[14] - '0') * 10 + static_cast<uint64_t>(val[15] - '0');
+}
+
+uint64_t key(const my_movable& val) {
+    return static_cast<uint64_t>(val.get_val());
+}
+
+template<typename T>
+struct mutator {
+    T operator()(T val) const {
+        return mutate(std::move(val));
+    }
+};
+
+template<typename T>
+struct stage_predicate {
+    uint64_t stage;
+
+    bool operator()(const T& val) const {
+        return stage != (key(val) & 63);
+    }
+};
+
+template<typename T>
+struct discard {
+    void operator()(T) const { }
+};
+
+template<typename T>
+std::vector<T> make_source(const std::vector<int>& master) {
+    auto vec = std::vector<T>{};
+    vec.reserve(master.size());
+    for (int val : master) {
+        vec.emplace_back(make_elem(val, static_cast<T*>(nullptr)));
+    }
+    return vec;
+}
+
+// generic source for range_adapter scenarios
+
+template<typename T>
+class vector_source : public sl::ranges::range_adapter<vector_source<T>, T> {
+    std::vector<T> vec;
+    std::size_t idx = 0;
+
+public:
+    vector_source(std::vector<T>&& vec) :
+    vec(std::move(vec)) { }
+
+    vector_source(vector_source&& other) :
+    vec(std::move(other.vec)),
+    idx(other.idx) { }
+
+    bool compute_next() {
+        if (idx < vec.size()) {
+            return this->set_current(std::move(vec[idx++]));
+        } else {
+            return false;
+        }
+    }
+};
+
+// chains of wrappers
+
+template<typename T, int Depth>
+struct transform_chain {
+    template<typename Range>
+    static auto make(Range&& range) ->
+            decltype(transform_chain<T, Depth - 1>::make(sl::ranges::transform(std::move(range), mutator<T>()))) {
+        return transform_chain<T, Depth - 1>::make(sl::ranges::transform(std::move(range), mutator<T>()));
+    }
+};
+
+template<typename T>
+struct transform_chain<T, 0> {
+    template<typename Range>
+    static Range make(Range&& range) {
+        return std::move(range);
+    }
+};
+
+template<typename T, int Depth>
+struct filter_chain {
+    template<typename Range>
+    static auto make(Range&& range) ->
+            decltype(filter_chain<T, Depth - 1>::make(sl::ranges::filter(std::move(range),
+                    stage_predicate<T>(), discard<T>()))) {
+        return filter_chain<T, Depth - 1>::make(sl::ranges::filter(std::move(range),
+                stage_predicate<T>{static_cast<uint64_t>(Depth)}, discard<T>()));
+    }
+};
+
+template<typename T>
+struct filter_chain<T, 0> {
+    template<typename Range>
+    static Range make(Range&& range) {
+        return std::move(range);
+    }
+};
+
+template<typename T, int Depth>
+struct concat_chain {
+    template<typename Range>
+    static auto make(Range&& range, std::vector<std::vector<T>>& segments) ->
+            decltype(concat_chain<T, Depth - 1>::make(sl::ranges::concat(std::move(range),
+                    std::move(segments.front())), segments)) {
+        return concat_chain<T, Depth - 1>::make(sl::ranges::concat(std::move(range),
+                std::move(segments[segments.size() - Depth])), segments);
+    }
+};
+
+template<typename T>
+struct concat_chain<T, 0> {
+    template<typename Range>
+    static Range make(Range&& range, std::vector<std::vector<T>>&) {
+        return std::move(range);
+    }
+};
+
+// scenarios, each one has a wrapper and a raw loop implementation
+
+template<typename T, int Depth>
+struct transform_scenario {
+    static uint64_t run_range(std::vector<T> src) {
+        uint64_t sum = 0;
+        auto range = transform_chain<T, Depth>::make(std::move(src));
+        for (auto&& el : range) {
+            sum += key(el);
+        }
+        return sum;
+    }
+
+    static uint64_t run_raw(std::vector<T> src) {
+        uint64_t sum = 0;
+        for (auto& el : src) {
+            T val = std::move(el);
+            for (int i = 0; i < Depth; i++) {
+                val = mutate(std::move(val));
+            }
+            sum += key(val);
+        }
+        return sum;
+    }
+};
+
+template<typename T, int Depth>
+struct filter_scenario {
+    static uint64_t run_range(std::vector<T> src) {
+        uint64_t sum = 0;
+        auto range = filter_chain<T, Depth>::make(std::move(src));
+        for (auto&& el : range) {
+            sum += key(el);
+        }
+        return sum;
+    }
+
+    static uint64_t run_raw(std::vector<T> src) {
+        uint64_t sum = 0;
+        for (auto& el : src) {
+            T val = std::move(el);
+            bool accepted = true;
+            for (int i = Depth; i > 0; i--) {
+                if (static_cast<uint64_t>(i) == (key(val) & 63)) {
+                    accepted = false;
+                    break;
+                }
+            }
+            if (accepted) {
+                sum += key(val);
+            }
+        }
+        return sum;
+    }
+};
+
+template<typename T, int Depth>
+struct concat_scenario {
+    static std::vector<std::vector<T>> split(std::vector<T> src) {
+        auto segments = std::vector<std::vector<T>>();
+        std::size_t seg_size = src.size() / (Depth + 1) + 1;
+        for (std::size_t i = 0; i < src.size(); i += seg_size) {
+            auto seg = std::vector<T>();
+            for (std::size_t j = i; j < std::min(i + seg_size, src.size()); j++) {
+                seg.emplace_back(std::move(src[j]));
+            }
+            segments.emplace_back(std::move(seg));
+        }
+        segments.resize(Depth + 1);
+        return segments;
+    }
+
+    static uint64_t run_range(std::vector<T> src) {
+        auto segments = split(std::move(src));
+        auto first = std::move(segments.front());
+        auto range = concat_chain<T, Depth>::make(std::move(first), segments);
+        uint64_t sum = 0;
+        for (auto&& el : range) {
+            sum += key(el);
+        }
+        return sum;
+    }
+
+    static uint64_t run_raw(std::vector<T> src) {
+        auto segments = split(std::move(src));
+        uint64_t sum = 0;
+        for (auto& seg : segments) {
+            for (auto& el : seg) {
+                T val = std::move(el);
+                sum += key(val);
+            }
+        }
+        return sum;
+    }
+};
+
+template<typename T, int Depth>
+struct refwrap_scenario {
+    static uint64_t run_range(std::vector<T> src) {
+        uint64_t sum = 0;
+        auto range = sl::ranges::refwrap(src);
+        for (auto&& el : range) {
+            sum += key(el.get());
+        }
+        return sum;
+    }
+
+    static uint64_t run_raw(std::vector<T> src) {
+        uint64_t sum = 0;
+        for (auto& el : src) {
+            sum += key(el);
+        }
+        return sum;
+    }
+};
+
+template<typename T, int Depth>
+struct adapter_scenario {
+    static uint64_t run_range(std::vector<T> src) {
+        uint64_t sum = 0;
+        auto range = transform_chain<T, Depth - 1>::make(vector_source<T>(std::move(src)));
+        for (auto&& el : range) {
+            sum += key(el);
+        }
+        return sum;
+    }
+
+    static uint64_t run_raw(std::vector<T> src) {
+        return transform_scenario<T, Depth - 1>::run_raw(std::move(src));
+    }
+};
+
+// measurement
+
+struct result {
+    std::string name;
+    int depth;
+    std::size_t elements;
+    double ns_per_elem;
+    double raw_ns_per_elem;
+    double median_penalty;
+
+    double penalty() const {
+        return median_penalty;
+    }
+};
+
+struct config {
+    std::size_t size = 500000;
+    int repeats = 5;
+    int runs = 5;
+    std::string output;
+    std::string baseline;
+    double tolerance = 0.5;
+    double noise_floor = 0.5;
+    bool strict = false;
+};
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+template<typename T, typename Func>
+double measure(const std::vector<int>& master, int repeats, Func fun, uint64_t& checksum) {
+    auto best = std::chrono::nanoseconds::max();
+    for (int i = 0; i < repeats; i++) {
+        // source is prepared outside of the measured interval
+        auto src = make_source<T>(master);
+        auto start = std::chrono::steady_clock::now();
+        checksum = fun(std::move(src));
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(master.size());
+}
+
+template<template<typename, int> class Scenario, typename T, int Depth>
+struct depth_runner {
+    static void run(const std::string& name, const std::vector<int>& master, const config& conf,
+            int min_depth, int max_depth_run, std::vector<result>& results) {
+        depth_runner<Scenario, T, Depth - 1>::run(name, master, conf, min_depth, max_depth_run, results);
+        if (Depth < min_depth || Depth > max_depth_run) return;
+        auto ns = std::vector<double>();
+        auto raw_ns = std::vector<double>();
+        auto penalties = std::vector<double>();
+        for (int i = 0; i < conf.runs; i++) {
+            uint64_t range_sum = 0;
+            uint64_t raw_sum = 0;
+            ns.push_back(measure<T>(master, conf.repeats, Scenario<T, Depth>::run_range, range_sum));
+            raw_ns.push_back(measure<T>(master, conf.repeats, Scenario<T, Depth>::run_raw, raw_sum));
+            if (range_sum != raw_sum) {
+                throw std::runtime_error("Checksum mismatch, name: [" + name + "]," +
+                        " depth: [" + std::to_string(Depth) + "]");
+            }
+            penalties.push_back(raw_ns.back() > 0 ? ns.back() / raw_ns.back() : 0);
+        }
+        results.push_back(result{name, Depth, master.size(), median(ns), median(raw_ns), median(penalties)});
+    }
+};
+
+template<template<typename, int> class Scenario, typename T>
+struct depth_runner<Scenario, T, 0> {
+    static void run(const std::string&, const std::vector<int>&, const config&,
+            int, int, std::vector<result>&) { }
+};
+
+template<typename T>
+void run_type(const std::string& type_name, const config& conf, std::vector<result>& results) {
+    auto master = std::vector<int>();
+    master.reserve(conf.size);
+    for (std::size_t i = 0; i < conf.size; i++) {
+        master.push_back(static_cast<int>(i));
+    }
+    depth_runner<transform_scenario, T, max_depth>::run("transform/" + type_name, master, conf, 1, max_depth, results);
+    depth_runner<filter_scenario, T, max_depth>::run("filter/" + type_name, master, conf, 1, max_depth, results);
+    depth_runner<concat_scenario, T, max_depth>::run("concat/" + type_name, master, conf, 1, max_depth, results);
+    depth_runner<refwrap_scenario, T, max_depth>::run("refwrap/" + type_name, master, conf, 1, 1, results);
+    depth_runner<adapter_scenario, T, max_depth>::run("range_adapter/" + type_name, master, conf, 1, max_depth, results);
+}
+
+// reporting
+
+void write_results(std::ostream& out, const std::vector<result>& results) {
+    out << "# name\tdepth\telements\tns_per_elem\tmelems_per_sec\traw_ns_per_elem\tpenalty\n";
+    for (auto& res : results) {
+        out << res.name << '\t' << res.depth << '\t' << res.elements << '\t'
+                << res.ns_per_elem << '\t' << (1000.0 / res.ns_per_elem) << '\t'
+                << res.raw_ns_per_elem << '\t' << res.penalty() << '\n';
+    }
+}
+
+std::map<std::pair<std::string, int>, double> read_baseline(const std::string& path) {
+    std::ifstream stream(path);
+    if (!stream.good()) {
+        throw std::runtime_error("Cannot open baseline file, path: [" + path + "]");
+    }
+    auto baseline = std::map<std::pair<std::string, int>, double>();
+    auto line = std::string();
+    while (std::getline(stream, line)) {
+        if (line.empty() || '#' == line[0]) continue;
+        std::istringstream ls(line);
+        auto name = std::string();
+        int depth = 0;
+        std::size_t elements = 0;
+        double ns = 0;
+        double mps = 0;
+        double raw_ns = 0;
+        double penalty = 0;
+        if (ls >> name >> depth >> elements >> ns >> mps >> raw_ns >> penalty) {
+            baseline[std::make_pair(name, depth)] = penalty;
+        }
+    }
+    return baseline;
+}
+
+bool compare_baseline(const std::vector<result>& results, const config& conf) {
+    auto baseline = read_baseline(conf.baseline);
+    bool success = true;
+    for (auto& res : results) {
+        auto it = baseline.find(std::make_pair(res.name, res.depth));
+        if (baseline.end() == it) continue;
+        double ratio = it->second > 0 ? res.penalty() / it->second : 1;
+        // small penalties are dominated by timer and scheduling noise
+        if (ratio > 1 + conf.tolerance && res.penalty() - it->second > conf.noise_floor) {
+            std::cerr << "REGRESSION: " << res.name << " depth " << res.depth <<
+                    ", penalty: " << res.penalty() << ", baseline: " << it->second << std::endl;
+            success = false;
+        }
+    }
+    return success;
+}
+
+config parse_args(int argc, char** argv) {
+    auto conf = config();
+    for (int i = 1; i < argc; i++) {
+        auto arg = std::string(argv[i]);
+        if ("--strict" == arg) {
+            conf.strict = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error("Missing value for argument: [" + arg + "]");
+        }
+        auto val = std::string(argv[++i]);
+        if ("--size" == arg) {
+            conf.size = static_cast<std::size_t>(std::stoull(val));
+        } else if ("--repeats" == arg) {
+            conf.repeats = std::stoi(val);
+        } else if ("--runs" == arg) {
+            conf.runs = std::stoi(val);
+        } else if ("--output" == arg) {
+            conf.output = val;
+        } else if ("--baseline" == arg) {
+            conf.baseline = val;
+        } else if ("--tolerance" == arg) {
+            conf.tolerance = std::stod(val);
+        } else if ("--noise-floor" == arg) {
+            conf.noise_floor = std::stod(val);
+        } else {
+            throw std::runtime_error("Unknown argument: [" + arg + "]");
+        }
+    }
+    return conf;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        auto conf = parse_args(argc, argv);
+        if (conf.runs < 1 || conf.repeats < 1) {
+            throw std::runtime_error("Invalid number of runs or repeats specified");
+        }
+        auto results = std::vector<result>();
+        run_type<int>("int", conf, results);
+        run_type<std::string>("string", conf, results);
+        run_type<my_movable>("my_movable", conf, results);
+        if (conf.output.empty()) {
+            write_results(std::cout, results);
+        } else {
+            std::ofstream out(conf.output);
+            write_results(out, results);
+        }
+        if (!conf.baseline.empty() && !compare_baseline(results, conf) && conf.strict) {
+            return 2;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
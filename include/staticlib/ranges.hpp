@@ -24,12 +24,32 @@
 #ifndef STATICLIB_RANGES_HPP
 #define STATICLIB_RANGES_HPP
 
+#include "staticlib/ranges/batch_kernels.hpp"
+#include "staticlib/ranges/batch_range_adapter.hpp"
+#include "staticlib/ranges/chunked.hpp"
 #include "staticlib/ranges/concat.hpp"
+#include "staticlib/ranges/distinct.hpp"
+#include "staticlib/ranges/fd_records.hpp"
 #include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/flat_hash.hpp"
+#include "staticlib/ranges/flatten.hpp"
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/generator.hpp"
+#include "staticlib/ranges/group_aggregate.hpp"
+#include "staticlib/ranges/join.hpp"
+#include "staticlib/ranges/mapped_records.hpp"
+#include "staticlib/ranges/merge.hpp"
+#include "staticlib/ranges/parallel.hpp"
+#include "staticlib/ranges/prefetch.hpp"
 #include "staticlib/ranges/range_adapter.hpp"
 #include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/record_view.hpp"
 #include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/take_drop.hpp"
 #include "staticlib/ranges/transform.hpp"
+#include "staticlib/ranges/transform_batch.hpp"
+#include "staticlib/ranges/zip.hpp"
 
 // export namespace with shorter name
 namespace sl = staticlib;
@@ -0,0 +1,400 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   batch_kernels.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 5:15 PM
+ */
+
+#ifndef STATICLIB_RANGES_BATCH_KERNELS_HPP
+#define STATICLIB_RANGES_BATCH_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// SSE2 is a part of the base x86_64 instruction set,
+// AVX2 kernels are compiled separately and selected at runtime
+#if defined(__x86_64__) || defined(_M_X64)
+#define STATICLIB_RANGES_BATCH_SSE2
+#if defined(_MSC_VER)
+#define STATICLIB_RANGES_BATCH_AVX2
+#define STATICLIB_RANGES_BATCH_TARGET_AVX2
+#include <intrin.h>
+#include <immintrin.h>
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define STATICLIB_RANGES_BATCH_AVX2
+#define STATICLIB_RANGES_BATCH_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif // x86_64
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Instruction set levels used by batch kernels
+ */
+enum class simd_level { SCALAR, SSE2, AVX2 };
+
+/**
+ * Detects the best instruction set level supported by the current CPU
+ * (and by the compiler used to build the kernels)
+ *
+ * @return instruction set level
+ */
+inline simd_level detect_simd_level() {
+#if defined(STATICLIB_RANGES_BATCH_AVX2) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        // OSXSAVE and AVX, OS must preserve YMM registers
+        bool avx = 0 != (info[2] & (1 << 27)) && 0 != (info[2] & (1 << 28)) &&
+                6 == (_xgetbv(0) & 6);
+        __cpuidex(info, 7, 0);
+        if (avx && 0 != (info[1] & (1 << 5))) {
+            return simd_level::AVX2;
+        }
+    }
+    return simd_level::SSE2;
+#elif defined(STATICLIB_RANGES_BATCH_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return simd_level::AVX2;
+    }
+    return simd_level::SSE2;
+#elif defined(STATICLIB_RANGES_BATCH_SSE2)
+    return simd_level::SSE2;
+#else
+    return simd_level::SCALAR;
+#endif
+}
+
+namespace detail_kernels {
+
+struct add_op {
+    static float apply(float a, float b) {
+        return a + b;
+    }
+
+    static double apply(double a, double b) {
+        return a + b;
+    }
+
+    // wraps around on overflow the same way as SIMD instructions
+    static int32_t apply(int32_t a, int32_t b) {
+        return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+    }
+
+    static uint64_t apply(uint64_t a, uint64_t b) {
+        return a + b;
+    }
+};
+
+struct multiply_op {
+    static float apply(float a, float b) {
+        return a * b;
+    }
+
+    static double apply(double a, double b) {
+        return a * b;
+    }
+
+    // wraps around on overflow the same way as SIMD instructions
+    static int32_t apply(int32_t a, int32_t b) {
+        return static_cast<int32_t>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b));
+    }
+
+    static uint64_t apply(uint64_t a, uint64_t b) {
+        return a * b;
+    }
+};
+
+template<typename T>
+struct is_supported {
+    static const bool value = std::is_same<T, float>::value ||
+            std::is_same<T, double>::value ||
+            std::is_same<T, int32_t>::value ||
+            std::is_same<T, uint64_t>::value;
+};
+
+// vectorized implementations process the largest prefix that fits
+// into the vector registers and return its length, the rest is processed
+// by the scalar loop; operations without vectorized implementation
+// (e.g. 64-bit multiplication) return 0
+
+template<typename Op, typename T>
+std::size_t run_sse2(Op, const T*, std::size_t, T, T*) {
+    return 0;
+}
+
+template<typename Op, typename T>
+std::size_t run_avx2(Op, const T*, std::size_t, T, T*) {
+    return 0;
+}
+
+#ifdef STATICLIB_RANGES_BATCH_SSE2
+
+inline std::size_t run_sse2(add_op, const float* in, std::size_t n, float value, float* out) {
+    __m128 vv = _mm_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(in + i), vv));
+    }
+    return i;
+}
+
+inline std::size_t run_sse2(multiply_op, const float* in, std::size_t n, float value, float* out) {
+    __m128 vv = _mm_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(in + i), vv));
+    }
+    return i;
+}
+
+inline std::size_t run_sse2(add_op, const double* in, std::size_t n, double value, double* out) {
+    __m128d vv = _mm_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(in + i), vv));
+    }
+    return i;
+}
+
+inline std::size_t run_sse2(multiply_op, const double* in, std::size_t n, double value, double* out) {
+    __m128d vv = _mm_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(in + i), vv));
+    }
+    return i;
+}
+
+inline std::size_t run_sse2(add_op, const int32_t* in, std::size_t n, int32_t value, int32_t* out) {
+    __m128i vv = _mm_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i vin = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(vin, vv));
+    }
+    return i;
+}
+
+inline std::size_t run_sse2(add_op, const uint64_t* in, std::size_t n, uint64_t value, uint64_t* out) {
+    __m128i vv = _mm_set1_epi64x(static_cast<long long>(value));
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i vin = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi64(vin, vv));
+    }
+    return i;
+}
+
+#endif // STATICLIB_RANGES_BATCH_SSE2
+
+#ifdef STATICLIB_RANGES_BATCH_AVX2
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(add_op, const float* in, std::size_t n, float value, float* out) {
+    __m256 vv = _mm256_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(in + i), vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(multiply_op, const float* in, std::size_t n, float value, float* out) {
+    __m256 vv = _mm256_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(in + i), vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(add_op, const double* in, std::size_t n, double value, double* out) {
+    __m256d vv = _mm256_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(in + i), vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(multiply_op, const double* in, std::size_t n, double value, double* out) {
+    __m256d vv = _mm256_set1_pd(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(in + i), vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(add_op, const int32_t* in, std::size_t n, int32_t value, int32_t* out) {
+    __m256i vv = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vin = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(vin, vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(multiply_op, const int32_t* in, std::size_t n, int32_t value, int32_t* out) {
+    __m256i vv = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vin = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_mullo_epi32(vin, vv));
+    }
+    return i;
+}
+
+STATICLIB_RANGES_BATCH_TARGET_AVX2
+inline std::size_t run_avx2(add_op, const uint64_t* in, std::size_t n, uint64_t value, uint64_t* out) {
+    __m256i vv = _mm256_set1_epi64x(static_cast<long long>(value));
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i vin = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi64(vin, vv));
+    }
+    return i;
+}
+
+#endif // STATICLIB_RANGES_BATCH_AVX2
+
+template<typename Op, typename T>
+void run(Op op, simd_level level, const T* in, std::size_t n, T value, T* out) {
+    std::size_t done = 0;
+    switch (level) {
+    case simd_level::AVX2:
+        done = run_avx2(op, in, n, value, out);
+        break;
+    case simd_level::SSE2:
+        done = run_sse2(op, in, n, value, out);
+        break;
+    default:
+        break;
+    }
+    for (std::size_t i = done; i < n; i++) {
+        out[i] = Op::apply(in[i], value);
+    }
+}
+
+inline simd_level clamp_level(simd_level requested) {
+    simd_level detected = detect_simd_level();
+    return static_cast<int>(requested) < static_cast<int>(detected) ? requested : detected;
+}
+
+/**
+ * Kernel that applies binary operation with the constant operand
+ * to each element of the input block
+ */
+template<typename Op, typename T>
+class constant_kernel {
+    static_assert(is_supported<T>::value,
+            "Only 'float', 'double', 'int32_t' and 'uint64_t' elements are supported");
+
+    T value;
+    simd_level level;
+
+public:
+    constant_kernel(T value, simd_level max_level) :
+    value(value),
+    level(clamp_level(max_level)) { }
+
+    /**
+     * Applies the operation to the input block
+     *
+     * @param in pointer to the first input element
+     * @param n number of elements
+     * @param out pointer to the first output element, can be the same as input
+     */
+    void operator()(const T* in, std::size_t n, T* out) const {
+        run(Op(), level, in, n, value, out);
+    }
+
+    /**
+     * Instruction set level used by this kernel
+     *
+     * @return instruction set level
+     */
+    simd_level get_level() const {
+        return level;
+    }
+};
+
+} // namespace
+
+/**
+ * Kernel type returned from `batch_add`
+ */
+template<typename T>
+using add_kernel = detail_kernels::constant_kernel<detail_kernels::add_op, T>;
+
+/**
+ * Kernel type returned from `batch_multiply`
+ */
+template<typename T>
+using multiply_kernel = detail_kernels::constant_kernel<detail_kernels::multiply_op, T>;
+
+/**
+ * Creates a batch kernel, that adds specified value to each element,
+ * to be used with `transform_batch`. Supported element types are `float`, `double`,
+ * `int32_t` and `uint64_t`. Instruction set is detected once on kernel creation,
+ * integer overflow wraps around.
+ *
+ * @param value value to add
+ * @param max_level max instruction set level to use
+ * @return batch kernel
+ */
+template<typename T>
+add_kernel<T> batch_add(T value, simd_level max_level = simd_level::AVX2) {
+    return add_kernel<T>(value, max_level);
+}
+
+/**
+ * Creates a batch kernel, that multiplies each element by specified value,
+ * to be used with `transform_batch`. Supported element types are `float`, `double`,
+ * `int32_t` and `uint64_t`. Instruction set is detected once on kernel creation,
+ * integer overflow wraps around. `int32_t` multiplication is vectorized only with AVX2,
+ * `uint64_t` multiplication is not vectorized.
+ *
+ * @param value value to multiply by
+ * @param max_level max instruction set level to use
+ * @return batch kernel
+ */
+template<typename T>
+multiply_kernel<T> batch_multiply(T value, simd_level max_level = simd_level::AVX2) {
+    return multiply_kernel<T>(value, max_level);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_BATCH_KERNELS_HPP */
@@ -0,0 +1,326 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   batch_range_adapter.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 10:20 PM
+ */
+
+#ifndef STATICLIB_RANGES_BATCH_RANGE_ADAPTER_HPP
+#define STATICLIB_RANGES_BATCH_RANGE_ADAPTER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/size_hint.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_batch_adapter {
+
+/**
+ * Iterator implementation for the batch range adapter.
+ * Holds a reference to the range and serves elements from its buffer.
+ */
+template<typename Adapter>
+class batch_adapter_iter {
+    Adapter* range;
+
+public:
+    using value_type = typename Adapter::value_type;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param range parent range, `nullptr` for "past the end" iterator
+     */
+    batch_adapter_iter(Adapter* range) :
+    range(range) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    batch_adapter_iter(const batch_adapter_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_adapter_iter& operator=(const batch_adapter_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    batch_adapter_iter(batch_adapter_iter&& other) :
+    range(other.range) {
+        other.range = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_adapter_iter& operator=(batch_adapter_iter&& other) {
+        this->range = other.range;
+        other.range = nullptr;
+        return *this;
+    }
+
+    /**
+     * Iterates to the next element, requests the next batch
+     * when the current one is exhausted
+     *
+     * @return reference to this iterator instance
+     */
+    batch_adapter_iter& operator++() {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Iterates to the next element, requests the next batch
+     * when the current one is exhausted
+     *
+     * @return reference to this iterator instance
+     */
+    batch_adapter_iter& operator++(int) {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Will move out current element from the batch buffer
+     *
+     * @return current element
+     */
+    value_type operator*() {
+        if (range) {
+            return range->current_element();
+        } else {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+    }
+
+    /**
+     * Compares this iterator instance with a "past the end"
+     * Does NOT support arbitrary input instances,
+     * should be used only to compare with "past the end" iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const batch_adapter_iter& end) const {
+        return (this->range && !this->range->exhausted()) ||
+                (end.range && !end.range->exhausted());
+    }
+};
+
+} // namespace
+
+/**
+ * Abstract Range for sources, that naturally produce elements in blocks
+ * (decoded pages, framed records etc). Inheritors should implement a single method
+ * `bool compute_next_batch(std::vector<Elem>& buffer)` that should append
+ * next elements to the (empty) buffer and return `true` if more batches may follow,
+ * or `false` if source is exhausted (elements appended during this call
+ * are still returned). `batch_size()` can be used as a preferred number of elements
+ * to append. Iterators serve elements from the buffer with a simple index bump,
+ * `fused_for_each` pushes whole batches to the sink in a tight loop.
+ * Inheritors should use CRTP - `compute_next_batch` will be called using compile-time
+ * polymorphism. Inheritors that know the number of remaining elements may
+ * additionally implement `size_hint get_size_hint() const` method.
+ */
+template<typename Range, typename Elem>
+class batch_range_adapter {
+    friend class detail_batch_adapter::batch_adapter_iter<batch_range_adapter>;
+
+    std::vector<Elem> buffer;
+    std::size_t pos = 0;
+    std::size_t preferred_size;
+    bool started = false;
+    bool has_more = true;
+
+protected:
+    /**
+     * Constructor for inheritors
+     *
+     * @param batch_size preferred number of elements in a single batch
+     */
+    batch_range_adapter(std::size_t batch_size = 1024) :
+    preferred_size(batch_size > 0 ? batch_size : 1) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    batch_range_adapter(const batch_range_adapter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_range_adapter& operator=(const batch_range_adapter& other) = delete;
+
+    /**
+     * Move constructor, must not be used after `begin()` is called
+     * on other instance
+     *
+     * @param other other instance
+     */
+    batch_range_adapter(batch_range_adapter&& other) :
+    buffer(std::move(other.buffer)),
+    pos(other.pos),
+    preferred_size(other.preferred_size),
+    started(other.started),
+    has_more(other.has_more) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_range_adapter& operator=(batch_range_adapter&& other) = delete;
+
+    /**
+     * Preferred number of elements in a single batch
+     *
+     * @return batch size
+     */
+    std::size_t batch_size() const {
+        return preferred_size;
+    }
+
+public:
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = Elem;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_batch_adapter::batch_adapter_iter<batch_range_adapter>;
+
+    /**
+     * Returns `begin` iterator, requests the first batch
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        start();
+        find_element();
+        return iterator(this);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    /**
+     * Pushes all the elements into the specified sink batch by batch,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        start();
+        for (;;) {
+            for (std::size_t len = buffer.size(); pos < len;) {
+                if (!sink(std::move(buffer[pos++]))) {
+                    return false;
+                }
+            }
+            if (!has_more) {
+                return true;
+            }
+            fill_buffer();
+        }
+    }
+
+private:
+    void start() {
+        if (started) {
+            throw std::range_error("Invalid attempt to get a 'begin()' iterator the second time");
+        }
+        this->started = true;
+        buffer.reserve(preferred_size);
+    }
+
+    bool exhausted() const {
+        return pos >= buffer.size();
+    }
+
+    Elem current_element() {
+        return std::move(buffer[pos]);
+    }
+
+    void next_element() {
+        pos += 1;
+        find_element();
+    }
+
+    void find_element() {
+        while (pos >= buffer.size() && has_more) {
+            fill_buffer();
+        }
+    }
+
+    void fill_buffer() {
+        buffer.clear();
+        this->pos = 0;
+        this->has_more = static_cast<Range*> (this)->compute_next_batch(buffer);
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_BATCH_RANGE_ADAPTER_HPP */
@@ -0,0 +1,748 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   chunked.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 4:20 PM
+ */
+
+#ifndef STATICLIB_RANGES_CHUNKED_HPP
+#define STATICLIB_RANGES_CHUNKED_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Non-owning view over a contiguous block of elements, returned
+ * from the iterators of `chunked` ranges. Elements can be moved from.
+ * Chunk remains valid only until the iterator, that returned it,
+ * is incremented.
+ */
+template<typename T>
+class chunk {
+    T* ptr;
+    std::size_t len;
+
+public:
+    /**
+     * Type of the elements in this chunk
+     */
+    using value_type = typename std::remove_const<T>::type;
+
+    /**
+     * Type of the iterator over the elements in this chunk
+     */
+    using iterator = T*;
+
+    /**
+     * Constructor
+     *
+     * @param data pointer to the first element
+     * @param size number of elements
+     */
+    chunk(T* data, std::size_t size) :
+    ptr(data),
+    len(size) { }
+
+    /**
+     * Pointer to the first element
+     *
+     * @return pointer to the first element
+     */
+    T* data() const {
+        return ptr;
+    }
+
+    /**
+     * Number of elements in this chunk
+     *
+     * @return number of elements
+     */
+    std::size_t size() const {
+        return len;
+    }
+
+    /**
+     * Whether this chunk has no elements
+     *
+     * @return true if chunk is empty
+     */
+    bool empty() const {
+        return 0 == len;
+    }
+
+    /**
+     * Returns `begin` iterator
+     *
+     * @return `begin` iterator
+     */
+    T* begin() const {
+        return ptr;
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    T* end() const {
+        return ptr + len;
+    }
+
+    /**
+     * Unchecked access to the element with the specified index
+     *
+     * @param idx element index
+     * @return reference to element
+     */
+    T& operator[](std::size_t idx) const {
+        return ptr[idx];
+    }
+};
+
+namespace detail_chunked {
+
+/**
+ * Lazy `InputIterator` implementation for `chunked` operation.
+ * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Holds a pointer to the parent range that keeps the iteration state.
+ */
+template<typename Range>
+class chunked_iter {
+    Range* range;
+
+public:
+    using value_type = typename Range::value_type;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param range parent range, `nullptr` for "past the end" iterator
+     */
+    chunked_iter(Range* range) :
+    range(range) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    chunked_iter(const chunked_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    chunked_iter& operator=(const chunked_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    chunked_iter(chunked_iter&& other) :
+    range(other.range) {
+        other.range = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    chunked_iter& operator=(chunked_iter&& other) {
+        this->range = other.range;
+        other.range = nullptr;
+        return *this;
+    }
+
+    /**
+     * Iterates to the next chunk, invalidates the current one
+     *
+     * @return reference to iter instance
+     */
+    chunked_iter& operator++() {
+        if (range) {
+            range->next_chunk();
+        }
+        return *this;
+    }
+
+    /**
+     * Iterates to the next chunk, invalidates the current one
+     *
+     * @return reference to iter instance
+     */
+    chunked_iter& operator++(int) {
+        if (range) {
+            range->next_chunk();
+        }
+        return *this;
+    }
+
+    /**
+     * Returns current chunk
+     *
+     * @return current chunk
+     */
+    value_type operator*() {
+        if (range) {
+            return range->current_chunk();
+        } else {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+    }
+
+    /**
+     * Compares this iterator instance with a "past the end"
+     * Does NOT support arbitrary input instances,
+     * should be used only to compare with "past the end" iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const chunked_iter& end) const {
+        return (this->range && !this->range->exhausted()) ||
+                (end.range && !end.range->exhausted());
+    }
+};
+
+/**
+ * Sink that collects elements into the buffer and pushes full
+ * chunks to the next sink
+ */
+template<typename Elem, typename Sink>
+class chunking_sink {
+    std::vector<Elem>* buffer;
+    std::size_t chunk_size;
+    Sink* next;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param buffer buffer to collect elements into
+     * @param chunk_size max number of elements in chunk
+     * @param next next sink
+     */
+    chunking_sink(std::vector<Elem>& buffer, std::size_t chunk_size, Sink& next) :
+    buffer(std::addressof(buffer)),
+    chunk_size(chunk_size),
+    next(std::addressof(next)) { }
+
+    /**
+     * Adds specified element to the buffer, pushes the buffer to the next sink
+     * when it becomes full
+     *
+     * @param el element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Other>
+    bool operator()(Other&& el) {
+        buffer->emplace_back(std::move(el));
+        if (buffer->size() < chunk_size) {
+            return true;
+        }
+        return flush();
+    }
+
+    /**
+     * Pushes non-empty buffer to the next sink and clears it
+     *
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    bool flush() {
+        if (buffer->empty()) {
+            return true;
+        }
+        bool res = (*next)(chunk<Elem>(buffer->data(), buffer->size()));
+        buffer->clear();
+        return res;
+    }
+};
+
+inline size_hint chunks_hint(const size_hint& elements, std::size_t chunk_size) {
+    if (!elements.is_known()) {
+        return size_hint::unknown();
+    }
+    auto count = (elements.value() + chunk_size - 1) / chunk_size;
+    return elements.is_exact() ? size_hint::exact(count) : size_hint::upper_bound(count);
+}
+
+inline std::size_t checked_chunk_size(std::size_t chunk_size) {
+    if (0 == chunk_size) {
+        throw std::invalid_argument("Invalid zero chunk size specified");
+    }
+    return chunk_size;
+}
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for `chunked` operation
+ * over the contiguous containers (`std::vector`, `std::array`, `std::basic_string`).
+ * Returned chunks point directly into the source container, no elements are
+ * copied or moved. Source container is owned when `Holder` is not a reference.
+ */
+template<typename Holder>
+class contiguous_chunked_range {
+    friend class detail_chunked::chunked_iter<contiguous_chunked_range>;
+
+    Holder source_range;
+    std::size_t chunk_size;
+    std::size_t offset = 0;
+
+public:
+    /**
+     * Type of the elements of the source container, can be const
+     */
+    using element_type = typename std::remove_pointer<
+            decltype(std::declval<typename std::remove_reference<Holder>::type&>().data())>::type;
+
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = chunk<element_type>;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_chunked::chunked_iter<contiguous_chunked_range>;
+
+    /**
+     * Constructor
+     *
+     * @param source_range source container
+     * @param chunk_size max number of elements in chunk
+     */
+    contiguous_chunked_range(Holder&& source_range, std::size_t chunk_size) :
+    source_range(std::forward<Holder>(source_range)),
+    chunk_size(detail_chunked::checked_chunk_size(chunk_size)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    contiguous_chunked_range(const contiguous_chunked_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    contiguous_chunked_range& operator=(const contiguous_chunked_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    contiguous_chunked_range(contiguous_chunked_range&& other) :
+    source_range(std::forward<Holder>(other.source_range)),
+    chunk_size(other.chunk_size),
+    offset(other.offset) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    contiguous_chunked_range& operator=(contiguous_chunked_range&& other) = delete;
+
+    /**
+     * Returns `begin` iterator
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        offset = 0;
+        return iterator(this);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    /**
+     * Returns exact number of chunks in this range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return detail_chunked::chunks_hint(size_hint::exact(source_range.size()), chunk_size);
+    }
+
+    /**
+     * Pushes all the chunks of this range into the specified sink,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push chunks into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        auto data = source_range.data();
+        std::size_t size = source_range.size();
+        for (std::size_t from = 0; from < size; from += chunk_size) {
+            if (!sink(value_type(data + from, (std::min)(chunk_size, size - from)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    bool exhausted() const {
+        return offset >= source_range.size();
+    }
+
+    value_type current_chunk() {
+        return value_type(source_range.data() + offset,
+                (std::min)(chunk_size, source_range.size() - offset));
+    }
+
+    void next_chunk() {
+        offset += (std::min)(chunk_size, source_range.size() - offset);
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `chunked` operation
+ * over the arbitrary input ranges. Elements are moved from the source
+ * range into the internal buffer, that is reused for all the chunks.
+ * Range must not be moved after `begin()` is called.
+ */
+template<typename Range>
+class buffered_chunked_range {
+    friend class detail_chunked::chunked_iter<buffered_chunked_range>;
+
+    using source_iterator = decltype(std::declval<Range&>().begin());
+
+    Range source_range;
+    std::size_t chunk_size;
+    std::vector<typename std::decay<decltype(*std::declval<source_iterator&>())>::type> buffer;
+
+    // space for placement of source iterators (to not require DefaultConstructible)
+    typename std::aligned_storage<sizeof(source_iterator), std::alignment_of<source_iterator>::value>::type
+            begin_space;
+    typename std::aligned_storage<sizeof(source_iterator), std::alignment_of<source_iterator>::value>::type
+            end_space;
+    source_iterator* begin_ptr = nullptr;
+    source_iterator* end_ptr = nullptr;
+
+public:
+    /**
+     * Type of the elements moved from the source range
+     */
+    using element_type = typename std::decay<decltype(*std::declval<source_iterator&>())>::type;
+
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = chunk<element_type>;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_chunked::chunked_iter<buffered_chunked_range>;
+
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param chunk_size max number of elements in chunk
+     */
+    buffered_chunked_range(Range&& source_range, std::size_t chunk_size) :
+    source_range(std::move(source_range)),
+    chunk_size(detail_chunked::checked_chunk_size(chunk_size)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    buffered_chunked_range(const buffered_chunked_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    buffered_chunked_range& operator=(const buffered_chunked_range& other) = delete;
+
+    /**
+     * Move constructor, must not be used after `begin()` is called
+     * on other instance
+     *
+     * @param other other instance
+     */
+    buffered_chunked_range(buffered_chunked_range&& other) :
+    source_range(std::move(other.source_range)),
+    chunk_size(other.chunk_size),
+    buffer(std::move(other.buffer)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    buffered_chunked_range& operator=(buffered_chunked_range&& other) = delete;
+
+    /**
+     * Destructor
+     */
+    ~buffered_chunked_range() {
+        reset();
+    }
+
+    /**
+     * Returns `begin` iterator, fills the first chunk
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        reset();
+        this->begin_ptr = new (std::addressof(begin_space)) source_iterator(source_range.begin());
+        this->end_ptr = new (std::addressof(end_space)) source_iterator(source_range.end());
+        next_chunk();
+        return iterator(this);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    /**
+     * Returns size hint for the number of chunks, based
+     * on the size hint of the source range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return detail_chunked::chunks_hint(staticlib::ranges::get_size_hint(source_range), chunk_size);
+    }
+
+    /**
+     * Pushes all the chunks of this range into the specified sink,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push chunks into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        buffer.clear();
+        buffer.reserve(chunk_size);
+        auto stage = detail_chunked::chunking_sink<element_type, Sink>(buffer, chunk_size, sink);
+        if (!staticlib::ranges::fused_for_each(source_range, stage)) {
+            return false;
+        }
+        return stage.flush();
+    }
+
+private:
+    bool exhausted() const {
+        return buffer.empty();
+    }
+
+    value_type current_chunk() {
+        return value_type(buffer.data(), buffer.size());
+    }
+
+    void next_chunk() {
+        buffer.clear();
+        buffer.reserve(chunk_size);
+        auto& it = *begin_ptr;
+        while (buffer.size() < chunk_size && it != *end_ptr) {
+            buffer.emplace_back(std::move(*it));
+            ++it;
+        }
+    }
+
+    void reset() {
+        if (begin_ptr) {
+            begin_ptr->~source_iterator();
+            begin_ptr = nullptr;
+        }
+        if (end_ptr) {
+            end_ptr->~source_iterator();
+            end_ptr = nullptr;
+        }
+    }
+};
+
+
+/**
+ * Lazily splits contiguous container into chunks of up to specified number
+ * of elements, chunks point directly into the container.
+ * Created range wrapper will own specified container.
+ *
+ * @param range source container
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<!std::is_lvalue_reference<Range>::value &&
+                is_contiguous_container<typename std::decay<Range>::type>::value>::type>
+contiguous_chunked_range<Range> chunked(Range&& range, std::size_t chunk_size) {
+    return contiguous_chunked_range<Range>(std::move(range), chunk_size);
+}
+
+/**
+ * Lazily splits input range into chunks of up to specified number of elements.
+ * Elements are moved from source range one by one into the buffer, that
+ * is reused for all the chunks.
+ * All accessed elements of source range will be left in "valid but unspecified state".
+ * Created range wrapper will own specified range.
+ *
+ * @param range source range
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<!std::is_lvalue_reference<Range>::value &&
+                !is_contiguous_container<typename std::decay<Range>::type>::value>::type,
+        class = void>
+buffered_chunked_range<Range> chunked(Range&& range, std::size_t chunk_size) {
+    return buffered_chunked_range<Range>(std::move(range), chunk_size);
+}
+
+/**
+ * Lazily splits contiguous container into chunks of up to specified number
+ * of elements, chunks point directly into the container.
+ * Created range wrapper will NOT own specified container.
+ *
+ * @param range source container
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<is_contiguous_container<Range>::value>::type>
+contiguous_chunked_range<Range&> chunked(Range& range, std::size_t chunk_size) {
+    return contiguous_chunked_range<Range&>(range, chunk_size);
+}
+
+/**
+ * Lazily splits input range into chunks of up to specified number of elements.
+ * This overload is a "special-case" that will accept only (expectedly "temporary") input
+ * ranges which contain `std::reference_wrapper` elements.
+ * Created range wrapper will own specified range.
+ *
+ * @param range source range
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<!is_contiguous_container<Range>::value &&
+                is_reference_wrapper<typename Range::value_type>::value>::type,
+        class = void>
+buffered_chunked_range<Range> chunked(Range& range, std::size_t chunk_size) {
+    return chunked(std::move(range), chunk_size);
+}
+
+/**
+ * Lazily splits input range into chunks of up to specified number of elements.
+ * Chunks contain `std::reference_wrapper` instances pointing to source elements.
+ * Created range wrapper will NOT own specified range.
+ *
+ * @param range source range
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<!is_contiguous_container<Range>::value &&
+                !is_reference_wrapper<typename Range::value_type>::value>::type,
+        class = void, class = void>
+buffered_chunked_range<refwrapped_range<Range>> chunked(Range& range, std::size_t chunk_size) {
+    return chunked(staticlib::ranges::refwrap(range), chunk_size);
+}
+
+/**
+ * Lazily splits contiguous container into chunks of up to specified number
+ * of `const` elements, chunks point directly into the container.
+ * Created range wrapper will NOT own specified container.
+ *
+ * @param range source container
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<is_contiguous_container<Range>::value>::type>
+contiguous_chunked_range<const Range&> chunked(const Range& range, std::size_t chunk_size) {
+    return contiguous_chunked_range<const Range&>(range, chunk_size);
+}
+
+/**
+ * Lazily splits input range into chunks of up to specified number of elements.
+ * Chunks contain `std::reference_wrapper` instances pointing to `const` source elements.
+ * Created range wrapper will NOT own specified range.
+ *
+ * @param range source range
+ * @param chunk_size max number of elements in chunk
+ * @return chunked range
+ */
+template<typename Range,
+        class = typename std::enable_if<!is_contiguous_container<Range>::value>::type,
+        class = void>
+buffered_chunked_range<refwrapped_const_range<Range>> chunked(const Range& range, std::size_t chunk_size) {
+    return chunked(staticlib::ranges::refwrap(range), chunk_size);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_CHUNKED_HPP */
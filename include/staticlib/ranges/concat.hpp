@@ -24,12 +24,18 @@
 #ifndef STATICLIB_RANGES_CONCAT_HPP
 #define STATICLIB_RANGES_CONCAT_HPP
 
+#include <cstddef>
 #include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "staticlib/ranges/fusion.hpp"
 #include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
 #include "staticlib/ranges/traits.hpp"
 
 namespace staticlib {
@@ -37,16 +43,72 @@ namespace ranges {
 
 namespace detail_concat {
 
+/**
+ * Operations on the source iterator of the specified segment
+ */
+template<typename Elem, typename Tuple, std::size_t I>
+struct segment_ops {
+    static Elem deref(Tuple& iters) {
+        return Elem(std::move(*std::get<I>(iters)));
+    }
+
+    static void increment(Tuple& iters) {
+        ++std::get<I>(iters);
+    }
+
+    static bool exhausted(const Tuple& iters, const Tuple& ends) {
+        return !(std::get<I>(iters) != std::get<I>(ends));
+    }
+};
+
+/**
+ * Operations on the source iterator of the active segment, dispatched
+ * by its index at runtime through static tables of function pointers
+ */
+template<typename Elem, typename Tuple>
+struct segment {
+    template<std::size_t... Indices>
+    static Elem deref(Tuple& iters, std::size_t active, index_sequence<Indices...>) {
+        using fun_type = Elem(*)(Tuple&);
+        static const fun_type table[] = {&segment_ops<Elem, Tuple, Indices>::deref...};
+        if (active >= sizeof...(Indices)) {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+        return table[active](iters);
+    }
+
+    template<std::size_t... Indices>
+    static void increment(Tuple& iters, std::size_t active, index_sequence<Indices...>) {
+        using fun_type = void(*)(Tuple&);
+        static const fun_type table[] = {&segment_ops<Elem, Tuple, Indices>::increment...};
+        if (active < sizeof...(Indices)) {
+            table[active](iters);
+        }
+    }
+
+    template<std::size_t... Indices>
+    static bool exhausted(const Tuple& iters, const Tuple& ends, std::size_t active, index_sequence<Indices...>) {
+        using fun_type = bool(*)(const Tuple&, const Tuple&);
+        static const fun_type table[] = {&segment_ops<Elem, Tuple, Indices>::exhausted...};
+        return active >= sizeof...(Indices) || table[active](iters, ends);
+    }
+};
+
 /**
  * Lazy `InputIterator` implementation for `concat` (or `chain`) operation.
  * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
- * Moves element from source iterators one by one and moves it out from `operator*` method.
+ * Keeps pairs of source iterators and the index of the active source,
+ * moves element from active source iterator one by one and moves it out
+ * from `operator*` method. Per-element cost does not depend on the number
+ * of source ranges.
  */
-template<typename Iter1, typename Iter2, typename Elem>
+template<typename Elem, typename... Iters>
 class concatted_iter {
-    Iter1 source_iter1;
-    Iter1 source_iter1_end;
-    Iter2 source_iter2;
+    using segment_type = segment<Elem, std::tuple<Iters...>>;
+
+    std::tuple<Iters...> source_iters;
+    std::tuple<Iters...> source_iters_end;
+    std::size_t active;
 
 public:
     using value_type = Elem;
@@ -60,14 +122,18 @@ public:
     /**
      * Constructor
      * 
-     * @param source_iter1 `begin` first source iterator
-     * @param source_iter1_end `past_the_end` first source iterator
-     * @param source_iter2 `begin` second iterator
+     * @param source_iters `begin` source iterators
+     * @param source_iters_end `past_the_end` source iterators
+     * @param active index of the first source to take elements from,
+     *        number of sources for "past the end" iterator
      */
-    concatted_iter(Iter1 source_iter1, Iter1 source_iter1_end, Iter2 source_iter2) :
-    source_iter1(std::move(source_iter1)),
-    source_iter1_end(std::move(source_iter1_end)),
-    source_iter2(std::move(source_iter2)) { }
+    concatted_iter(std::tuple<Iters...>&& source_iters, std::tuple<Iters...>&& source_iters_end,
+            std::size_t active) :
+    source_iters(std::move(source_iters)),
+    source_iters_end(std::move(source_iters_end)),
+    active(active) {
+        skip_exhausted();
+    }
     
     /**
      * Deleted copy constructor
@@ -90,9 +156,9 @@ public:
      * @param other other instance
      */
     concatted_iter(concatted_iter&& other) :
-    source_iter1(std::move(other.source_iter1)),
-    source_iter1_end(std::move(other.source_iter1_end)),
-    source_iter2(std::move(other.source_iter2)) { }
+    source_iters(std::move(other.source_iters)),
+    source_iters_end(std::move(other.source_iters_end)),
+    active(other.active) { }
 
     /**
      * Move assignment operator
@@ -101,15 +167,15 @@ public:
      * @return reference to this instance
      */
     concatted_iter& operator=(concatted_iter&& other) {
-        this->source_iter1 = std::move(other.source_iter1);
-        this->source_iter1_end = std::move(other.source_iter1_end);
-        this->source_iter2 = std::move(other.source_iter2);
+        this->source_iters = std::move(other.source_iters);
+        this->source_iters_end = std::move(other.source_iters_end);
+        this->active = other.active;
         return *this;
     }
 
     /**
-     * Increments first source iterator if it is not yet exhausted, 
-     * otherwise - increments second source iterator.
+     * Increments active source iterator, switches to the next
+     * non-empty source when active one is exhausted.
      * 
      * @return reference to this iterator
      */
@@ -119,8 +185,8 @@ public:
     }
 
     /**
-     * Increments first source iterator if it is not yet exhausted, 
-     * otherwise - increments second source iterator.
+     * Increments active source iterator, switches to the next
+     * non-empty source when active one is exhausted.
      * 
      * @return reference to this iterator
      */
@@ -135,11 +201,7 @@ public:
      * @return current element
      */
     Elem operator*() {
-        if (source_iter1 != source_iter1_end) {
-            return std::move(*source_iter1);
-        } else {
-            return std::move(*source_iter2);
-        }
+        return segment_type::deref(source_iters, active, make_index_sequence<sizeof...(Iters)>());
     }
 
     /**
@@ -150,57 +212,146 @@ public:
      * @return whether not both this and specified iterators are "past the end"
      */    
     bool operator!=(const concatted_iter& end) const {
-        return this->source_iter1 != end.source_iter1 ||
-                this->source_iter2 != end.source_iter2;
+        return this->active != end.active;
     }
     
 private:    
     void next() {
-        if (source_iter1 != source_iter1_end) {
-            ++source_iter1;
-        } else {
-            ++source_iter2;
+        segment_type::increment(source_iters, active, make_index_sequence<sizeof...(Iters)>());
+        skip_exhausted();
+    }
+
+    void skip_exhausted() {
+        while (active < sizeof...(Iters) &&
+                segment_type::exhausted(source_iters, source_iters_end, active,
+                        make_index_sequence<sizeof...(Iters)>())) {
+            active += 1;
         }
     }
 };
 
+/**
+ * Sink that converts elements of the source ranges into
+ * the result element type and pushes them to the next sink
+ */
+template<typename Elem, typename Sink>
+class converting_sink {
+    Sink* next;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param next next sink
+     */
+    converting_sink(Sink& next) :
+    next(std::addressof(next)) { }
+
+    /**
+     * Pushes specified element to the next sink
+     *
+     * @param el element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    bool operator()(Elem&& el) {
+        return (*next)(std::move(el));
+    }
+
+    /**
+     * Converts specified element into result element type
+     * and pushes it to the next sink
+     *
+     * @param el element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Other>
+    bool operator()(Other&& el) {
+        return (*next)(Elem(std::move(el)));
+    }
+};
+
+template<std::size_t I, std::size_t N>
+struct each_source {
+    template<typename Tuple>
+    static size_hint hint(const Tuple& sources) {
+        return staticlib::ranges::get_size_hint(std::get<I>(sources)).plus(
+                each_source<I + 1, N>::hint(sources));
+    }
+
+    template<typename Tuple, typename Sink>
+    static bool push(Tuple& sources, Sink& sink) {
+        return staticlib::ranges::fused_for_each(std::get<I>(sources), sink) &&
+                each_source<I + 1, N>::push(sources, sink);
+    }
+};
+
+template<std::size_t N>
+struct each_source<N, N> {
+    template<typename Tuple>
+    static size_hint hint(const Tuple&) {
+        return size_hint::exact(0);
+    }
+
+    template<typename Tuple, typename Sink>
+    static bool push(Tuple&, Sink&) {
+        return true;
+    }
+};
+
+template<typename Range, typename... Ranges>
+struct first_of {
+    using type = Range;
+};
+
 } // namespace
 
 
 /**
- * Lazy implementation of `SinglePassRange` for `concat` (or `chain`)  operation, 
+ * Lazy implementation of `SinglePassRange` for `concat` (or `chain`)  operation
+ * over an arbitrary number of source ranges,
  * after the pass all accessed elements of source ranges will be moved from
  * (will retain in "valid but unspecified" state).
+ * Result element type is the element type of the first source range, elements of
+ * other source ranges must be convertible to it.
  */
-template <typename Range1, typename Range2>
+template <typename... Ranges>
 class concatted_range {
-    Range1 source_range1;
-    Range2 source_range2;
+    static_assert(sizeof...(Ranges) > 0, "At least one source range must be specified");
+
+    std::tuple<Ranges...> source_ranges;
 
 public:
     /**
      * Type of iterator of first source range
      */
-    using iterator = decltype(std::declval<decltype(source_range1)>().begin());
+    using iterator = decltype(std::declval<typename detail_concat::first_of<Ranges...>::type&>().begin());
+
     /**
-     * Type of iterator of second source range
+     * Type of iterator of second source range (of first one, if only one range is concatenated),
+     * kept for compatibility with two-range `concatted_range<Range1, Range2>`
      */
-    using iterator2 = decltype(std::declval<decltype(source_range2)>().begin());
+    using iterator2 = decltype(std::declval<typename std::tuple_element<(sizeof...(Ranges) > 1 ? 1 : 0),
+            std::tuple<Ranges...>>::type&>().begin());
+
     /**
      * Result value type of iterators returned from this range
      */
     using value_type = typename std::iterator_traits<iterator>::value_type;
 
+    /**
+     * Result iterator type
+     */
+    using concatted_iterator = detail_concat::concatted_iter<value_type,
+            decltype(std::declval<Ranges&>().begin())...>;
+
     /**
      * Constructor,
      * created range wrapper will own specified ranges
      * 
-     * @param source_range1 first source range
-     * @param source_range2 second source range
+     * @param source_ranges source ranges
      */
-    concatted_range(Range1&& source_range1, Range2&& source_range2) :
-    source_range1(std::move(source_range1)),
-    source_range2(std::move(source_range2)) { }
+    concatted_range(Ranges&&... source_ranges) :
+    source_ranges(std::move(source_ranges)...) { }
     
     /**
      * Deleted copy constructor
@@ -223,8 +374,7 @@ public:
      * @param other other instance
      */
     concatted_range(concatted_range&& other) :
-    source_range1(std::move(other.source_range1)), 
-    source_range2(std::move(other.source_range2)) { };
+    source_ranges(std::move(other.source_ranges)) { };
 
     /**
      * Deleted move assignment operator
@@ -239,11 +389,8 @@ public:
      * 
      * @return `begin` iterator
      */    
-    detail_concat::concatted_iter<iterator, iterator2, value_type> begin() {
-        // move here is required by msvs
-        return detail_concat::concatted_iter<iterator, iterator2, value_type>{
-            std::move(source_range1.begin()), std::move(source_range1.end()), std::move(source_range2.begin())
-        };
+    concatted_iterator begin() {
+        return begin(make_index_sequence<sizeof...(Ranges)>());
     }
 
     /**
@@ -251,10 +398,31 @@ public:
      * 
      * @return `past_the_end` iterator
      */
-    detail_concat::concatted_iter<iterator, iterator2, value_type> end() {
-        return detail_concat::concatted_iter<iterator, iterator2, value_type>{
-            std::move(source_range1.end()), std::move(source_range1.end()), std::move(source_range2.end())
-        };
+    concatted_iterator end() {
+        return end(make_index_sequence<sizeof...(Ranges)>());
+    }
+
+    /**
+     * Returns size hint of this range, combined from
+     * the size hints of all source ranges
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return detail_concat::each_source<0, sizeof...(Ranges)>::hint(source_ranges);
+    }
+
+    /**
+     * Pushes all the elements of the source ranges one range
+     * after another into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        auto stage = detail_concat::converting_sink<value_type, Sink>(sink);
+        return detail_concat::each_source<0, sizeof...(Ranges)>::push(source_ranges, stage);
     }
 
     /**
@@ -264,83 +432,73 @@ public:
      * @return vector with processed elements
      */
     std::vector<value_type> to_vector() {
-        std::vector<value_type> vec;
-        for (auto&& el : *this) {
-            vec.emplace_back(std::move(el));
-        }
-        return vec;
+        return detail_fusion::collect(*this, std::vector<value_type>());
     }
-};
 
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        return detail_fusion::collect_allocated<value_type>(*this, alloc);
+    }
 
-/**
- * Lazily concatenates two input ranges into single output range.
- * Elements are moved from source ranges one by one,
- * All accessed elements of source ranges will be left in "valid but unspecified state".
- * Created range wrapper will own specified ranges
- * 
- * @param source_range1 first source range
- * @param source_range2 second source range
- * @return concatenated range
- */
-template <typename Range1, typename Range2,
-        class = typename std::enable_if<!std::is_lvalue_reference<Range1>::value>::type,
-        class = typename std::enable_if<!std::is_lvalue_reference<Range2>::value>::type> 
-concatted_range<Range1, Range2>
-concat(Range1&& range1, Range2&& range2) {
-    return concatted_range<Range1, Range2> (std::move(range1), std::move(range2));
-}
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
 
-/**
- * Lazily concatenates two input ranges into single output range.
- * Elements are moved from source ranges one by one,
- * All accessed elements of source ranges will be left in "valid but unspecified state".
- * Created range wrapper will own specified ranges.
- * This overload is a "special-case" that will accept only (expectedly "temporary") input
- * ranges which contain `std::reference_wrapper` elements.
- * 
- * @param source_range1 first source range
- * @param source_range2 second source range
- * @return concatenated range
- */
-template <typename Range1, typename Range2,
-    class = typename std::enable_if<is_reference_wrapper<typename Range1::value_type>::value>::type,
-    class = typename std::enable_if<is_reference_wrapper<typename Range2::value_type>::value>::type>
-concatted_range<Range1, Range2>
-concat(Range1& range1, Range2& range2) {
-    return concat(std::move(range1), std::move(range2));
-}
+private:
+    template<std::size_t... Indices>
+    concatted_iterator begin(index_sequence<Indices...>) {
+        // move here is required by msvs
+        return concatted_iterator(
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).begin())...),
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...),
+                0);
+    }
+
+    template<std::size_t... Indices>
+    concatted_iterator end(index_sequence<Indices...>) {
+        return concatted_iterator(
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...),
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...),
+                sizeof...(Ranges));
+    }
+};
 
-/**
- * Lazily concatenates two input ranges into single output range
- * taking elements by reference.
- * Created range wrapper will NOT own specified ranges.
- * 
- * @param source_range1 first source range
- * @param source_range2 second source range
- * @return concatenated range
- */
-template <typename Range1, typename Range2,
-        class = typename std::enable_if<!is_reference_wrapper<typename Range1::value_type>::value>::type,
-        class = typename std::enable_if<!is_reference_wrapper<typename Range2::value_type>::value>::type>
-concatted_range<staticlib::ranges::refwrapped_range<Range1>, staticlib::ranges::refwrapped_range<Range2>> 
-concat(Range1& range1, Range2& range2) {
-    return concat(staticlib::ranges::refwrap(range1), staticlib::ranges::refwrap(range2));
-}
 
 /**
- * Lazily concatenates two input ranges into single output range
- * taking elements by reference.
- * Created range wrapper will NOT own specified ranges.
+ * Lazily concatenates input ranges into single output range.
+ * Elements are moved from source ranges one by one,
+ * All accessed elements of source ranges will be left in "valid but unspecified state".
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ * Result element type is the element type of the first range, elements of other ranges
+ * must be convertible to it.
  * 
- * @param source_range1 first source range
- * @param source_range2 second source range
+ * @param ranges source ranges
  * @return concatenated range
  */
-template <typename Range1, typename Range2>
-concatted_range<staticlib::ranges::refwrapped_const_range<Range1>, staticlib::ranges::refwrapped_const_range<Range2>>
-concat(const Range1& range1, const Range2& range2) {
-    return concat(staticlib::ranges::refwrap(range1), staticlib::ranges::refwrap(range2));
+template <typename... Ranges>
+concatted_range<typename detail_refwrap::adapted<Ranges>::type...>
+concat(Ranges&&... ranges) {
+    return concatted_range<typename detail_refwrap::adapted<Ranges>::type...>(
+            detail_refwrap::adapted<Ranges>::adapt(std::forward<Ranges>(ranges))...);
 }
 
 } // namespace
@@ -0,0 +1,331 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   delegated_iter.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 6:05 PM
+ */
+
+#ifndef STATICLIB_RANGES_DELEGATED_ITER_HPP
+#define STATICLIB_RANGES_DELEGATED_ITER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_delegated_iter {
+
+template<typename Traversal, typename Tag>
+using enable_if_traversal = typename std::enable_if<std::is_base_of<Tag, Traversal>::value>::type;
+
+} // namespace
+
+/**
+ * CRTP base for lazy iterators, that wrap a source iterator and compute
+ * returned elements in `operator*` of the `Derived` class.
+ * Movement and comparison operations are delegated to the source iterator,
+ * bidirectional and random-access operations are available only when
+ * `Traversal` supports them.
+ * Returned elements are not references, so `iterator_category` is always
+ * `std::input_iterator_tag`, supported multi-pass operations are reported
+ * with `iterator_concept`.
+ * Supports `CopyConstructible` and `CopyAssignable` only when source iterator does.
+ */
+template<typename Derived, typename Iter, typename Traversal>
+class delegated_iter {
+protected:
+    /**
+     * Source iterator
+     */
+    Iter source_iter;
+
+    /**
+     * Constructor
+     *
+     * @param source_iter source iterator
+     */
+    explicit delegated_iter(Iter source_iter) :
+    source_iter(std::move(source_iter)) { }
+
+public:
+    // lazy iterators return elements by value, multi-pass operations
+    // are available only when source iterator supports them
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = Traversal;
+    using difference_type = typename std::conditional<
+            std::is_base_of<std::forward_iterator_tag, Traversal>::value,
+            typename std::iterator_traits<Iter>::difference_type,
+            std::nullptr_t>::type;
+    using pointer = std::nullptr_t;
+
+    /**
+     * Delegated prefix operator implementation
+     *
+     * @return reference to iter instance
+     */
+    Derived& operator++() {
+        ++source_iter;
+        return derived();
+    }
+
+    /**
+     * Delegated postfix operator implementation, returns a copy of
+     * iter instance for multi-pass source iterators
+     *
+     * @return reference to iter instance for input source iterators,
+     *         copy of the iter instance before increment otherwise
+     */
+    typename std::conditional<std::is_base_of<std::forward_iterator_tag, Traversal>::value,
+            Derived, Derived&>::type operator++(int) {
+        return postfix_increment(std::integral_constant<bool,
+                std::is_base_of<std::forward_iterator_tag, Traversal>::value>());
+    }
+
+    /**
+     * Delegated operator implementation, does NOT support arbitrary input instances
+     * for input source iterators, should be used only to compare with `past_the_end` iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const Derived& end) const {
+        return this->source_iter != base(end).source_iter;
+    }
+
+    /**
+     * Delegated operator implementation
+     *
+     * @param other other iterator
+     * @return whether this and specified iterators point to the same element
+     */
+    bool operator==(const Derived& other) const {
+        return this->source_iter == base(other).source_iter;
+    }
+
+    /**
+     * Delegated prefix operator implementation,
+     * available only for bidirectional source iterators
+     *
+     * @return reference to iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::bidirectional_iterator_tag>>
+    Derived& operator--() {
+        --source_iter;
+        return derived();
+    }
+
+    /**
+     * Delegated postfix operator implementation,
+     * available only for bidirectional source iterators
+     *
+     * @return iter instance pointing to the previous position
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::bidirectional_iterator_tag>>
+    Derived operator--(int) {
+        Derived copy(derived());
+        --source_iter;
+        return copy;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param n number of positions to advance
+     * @return reference to iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    Derived& operator+=(difference_type n) {
+        source_iter += n;
+        return derived();
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param n number of positions to move back
+     * @return reference to iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    Derived& operator-=(difference_type n) {
+        source_iter -= n;
+        return derived();
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param n number of positions to advance
+     * @return advanced iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    Derived operator+(difference_type n) const {
+        Derived res(derived());
+        res += n;
+        return res;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param n number of positions to advance
+     * @param it iterator
+     * @return advanced iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    friend Derived operator+(difference_type n, const Derived& it) {
+        return it + n;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param n number of positions to move back
+     * @return moved back iter instance
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    Derived operator-(difference_type n) const {
+        Derived res(derived());
+        res -= n;
+        return res;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param other other iterator
+     * @return distance between specified and this iterators
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    difference_type operator-(const Derived& other) const {
+        return this->source_iter - base(other).source_iter;
+    }
+
+    /**
+     * Returns the element with the specified offset from the current one,
+     * available only for random-access source iterators
+     *
+     * @param n offset from the current element
+     * @return element
+     */
+    template<typename T = Traversal, typename D = Derived,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    auto operator[](difference_type n) const -> decltype(*std::declval<D&>()) {
+        D res(derived());
+        res += n;
+        return *res;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param other other iterator
+     * @return whether this iterator points before the specified one
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    bool operator<(const Derived& other) const {
+        return this->source_iter < base(other).source_iter;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param other other iterator
+     * @return whether this iterator points after the specified one
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    bool operator>(const Derived& other) const {
+        return this->source_iter > base(other).source_iter;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param other other iterator
+     * @return whether this iterator does not point after the specified one
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    bool operator<=(const Derived& other) const {
+        return this->source_iter <= base(other).source_iter;
+    }
+
+    /**
+     * Delegated operator implementation,
+     * available only for random-access source iterators
+     *
+     * @param other other iterator
+     * @return whether this iterator does not point before the specified one
+     */
+    template<typename T = Traversal,
+            class = detail_delegated_iter::enable_if_traversal<T, std::random_access_iterator_tag>>
+    bool operator>=(const Derived& other) const {
+        return this->source_iter >= base(other).source_iter;
+    }
+
+private:
+    Derived& derived() {
+        return static_cast<Derived&>(*this);
+    }
+
+    const Derived& derived() const {
+        return static_cast<const Derived&>(*this);
+    }
+
+    static const delegated_iter& base(const Derived& it) {
+        return static_cast<const delegated_iter&>(it);
+    }
+
+    Derived& postfix_increment(std::false_type) {
+        source_iter++;
+        return derived();
+    }
+
+    Derived postfix_increment(std::true_type) {
+        Derived copy(derived());
+        ++source_iter;
+        return copy;
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_DELEGATED_ITER_HPP */
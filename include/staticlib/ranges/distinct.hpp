@@ -0,0 +1,433 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   distinct.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 1:00 PM
+ */
+
+#ifndef STATICLIB_RANGES_DISTINCT_HPP
+#define STATICLIB_RANGES_DISTINCT_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/flat_hash.hpp"
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_distinct {
+
+/**
+ * Key type of the element, `std::reference_wrapper` elements are unwrapped
+ */
+template<typename Elem>
+struct key_of {
+    using type = Elem;
+};
+
+template<typename T>
+struct key_of<std::reference_wrapper<T>> {
+    using type = typename std::remove_const<T>::type;
+};
+
+template<typename T>
+const T& unwrap(const T& el) {
+    return el;
+}
+
+template<typename T>
+const T& unwrap(const std::reference_wrapper<T>& el) {
+    return el.get();
+}
+
+template<typename Range>
+using elem_type = typename std::iterator_traits<decltype(std::declval<Range&>().begin())>::value_type;
+
+template<typename Range>
+using key_type = typename key_of<elem_type<Range>>::type;
+
+/**
+ * Hash function for the values that are already hashes
+ */
+struct identity_hash {
+    std::size_t operator()(std::size_t hash) const {
+        return hash;
+    }
+};
+
+/**
+ * Set of seen elements, that keeps copies of the keys
+ */
+template<typename Key, typename Hash, typename Eq>
+class exact_keys {
+    flat_hash_set<Key, Hash, Eq> keys;
+
+public:
+    exact_keys(Hash hasher, Eq equal) :
+    keys(0, std::move(hasher), std::move(equal)) { }
+
+    exact_keys(exact_keys&& other) :
+    keys(std::move(other.keys)) { }
+
+    void reserve(std::size_t expected_size) {
+        keys.reserve(expected_size);
+    }
+
+    bool insert(const Key& key) {
+        return keys.insert(key);
+    }
+};
+
+/**
+ * Set of seen elements, that keeps only the hashes of the keys
+ */
+template<typename Key, typename Hash>
+class hashed_keys {
+    flat_hash_set<std::size_t, identity_hash> hashes;
+    Hash hasher;
+
+public:
+    hashed_keys(Hash hasher) :
+    hasher(std::move(hasher)) { }
+
+    hashed_keys(hashed_keys&& other) :
+    hashes(std::move(other.hashes)),
+    hasher(std::move(other.hasher)) { }
+
+    void reserve(std::size_t expected_size) {
+        hashes.reserve(expected_size);
+    }
+
+    bool insert(const Key& key) {
+        return hashes.insert(hasher(key));
+    }
+};
+
+/**
+ * Sink for `distinct` operation, pushes first occurrences to the next sink
+ * and duplicates to the offcast destination
+ */
+template<typename Seen, typename Dest, typename Sink>
+class distinct_sink {
+    Seen* seen;
+    Dest* offcast_dest;
+    Sink* next;
+
+public:
+    distinct_sink(Seen& seen, Dest& offcast_dest, Sink& next) :
+    seen(std::addressof(seen)),
+    offcast_dest(std::addressof(offcast_dest)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        if (seen->insert(unwrap(el))) {
+            return (*next)(std::move(el));
+        }
+        (*offcast_dest)(std::move(el));
+        return true;
+    }
+};
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for `distinct` operation, passes only
+ * the first occurrence of each element, duplicates are applied to the specified `FunctionObject`
+ * in the same way as `filter` offcasts. Seen elements are kept in the open-addressing
+ * `flat_hash_set`, that is pre-sized from the specified capacity or from the size hint
+ * of the source range on the first access (upper bound hints are capped, as in `reserve_for`).
+ * Elements are moved from source range one by one.
+ */
+template<typename Range, typename Seen, typename Dest>
+class distinct_range : public range_adapter<distinct_range<Range, Seen, Dest>,
+        detail_distinct::elem_type<Range>> {
+    using elem_type = detail_distinct::elem_type<Range>;
+    using iterator = decltype(std::declval<Range&>().begin());
+
+    // `it` points to the last element taken from the source
+    // and is advanced on the next access
+    struct cursor {
+        iterator it;
+        iterator end;
+
+        void advance() {
+            if (it != end) {
+                ++it;
+            }
+        }
+    };
+
+    Range source_range;
+    Seen seen;
+    Dest offcast_dest;
+    std::size_t capacity;
+    std::unique_ptr<cursor> cur;
+    bool started = false;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param seen set of seen elements
+     * @param offcast_dest `FunctionObject` to apply duplicate elements to it
+     * @param capacity expected number of distinct elements, `0` to use the size hint of the source
+     */
+    distinct_range(Range&& source_range, Seen&& seen, Dest offcast_dest, std::size_t capacity) :
+    source_range(std::move(source_range)),
+    seen(std::move(seen)),
+    offcast_dest(std::move(offcast_dest)),
+    capacity(capacity) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    distinct_range(const distinct_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    distinct_range& operator=(const distinct_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    distinct_range(distinct_range&& other) :
+    range_adapter<distinct_range<Range, Seen, Dest>, elem_type>(std::move(other)),
+    source_range(std::move(other.source_range)),
+    seen(std::move(other.seen)),
+    offcast_dest(std::move(other.offcast_dest)),
+    capacity(other.capacity),
+    cur(std::move(other.cur)),
+    started(other.started) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    distinct_range& operator=(distinct_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range as an upper bound
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range).as_upper_bound();
+    }
+
+    /**
+     * Finds next element, that was not seen before
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        start();
+        // source is advanced lazily, so the returned element (that may
+        // point into the source, e.g. `record_view`) stays valid until the next increment
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new cursor{std::move(source_range.begin()), std::move(source_range.end())});
+        } else {
+            cur->advance();
+        }
+        for (; cur->it != cur->end; ++cur->it) {
+            elem_type el = std::move(*cur->it);
+            if (seen.insert(detail_distinct::unwrap(el))) {
+                return this->set_current(std::move(el));
+            }
+            offcast_dest(std::move(el));
+        }
+        detail_filter::flush_offcast(offcast_dest, detail_filter::own());
+        return false;
+    }
+
+    /**
+     * Pushes all the remaining elements, that were not seen before,
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        start();
+        auto stage = detail_distinct::distinct_sink<Seen, Dest, Sink>(seen, offcast_dest, sink);
+        if (!cur) {
+            bool res = staticlib::ranges::fused_for_each(source_range, stage);
+            if (res) {
+                detail_filter::flush_offcast(offcast_dest, detail_filter::own());
+            }
+            return res;
+        }
+        for (cur->advance(); cur->it != cur->end; ++cur->it) {
+            if (!stage(std::move(*cur->it))) {
+                return false;
+            }
+        }
+        detail_filter::flush_offcast(offcast_dest, detail_filter::own());
+        return true;
+    }
+
+private:
+    void start() {
+        if (!started) {
+            this->started = true;
+            auto hint = staticlib::ranges::get_size_hint(source_range);
+            if (capacity > 0) {
+                seen.reserve(capacity);
+            } else if (hint.is_known()) {
+                seen.reserve(detail_size_hint::reserved_count(hint));
+            }
+        }
+    }
+};
+
+/**
+ * Lazily removes duplicates from the input range using specified hash and equality functions,
+ * see `distinct_range`. Keys of the distinct elements are copied into the set of seen elements,
+ * use `distinct_hashes` for move-only elements.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @param hasher hash function
+ * @param equal key equality function
+ * @param offcast_dest `FunctionObject` to apply duplicate elements to it
+ * @param capacity expected number of distinct elements, `0` (default) to use the size hint of the source
+ * @return distinct range
+ */
+template<typename Range, typename Hash, typename Eq, typename Dest>
+distinct_range<typename detail_refwrap::adapted<Range>::type,
+        detail_distinct::exact_keys<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>, Hash, Eq>,
+        Dest>
+distinct(Range&& range, Hash hasher, Eq equal, Dest offcast_dest, std::size_t capacity = 0) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    using seen_type = detail_distinct::exact_keys<detail_distinct::key_type<range_type>, Hash, Eq>;
+    return distinct_range<range_type, seen_type, Dest>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)),
+            seen_type(std::move(hasher), std::move(equal)), std::move(offcast_dest), capacity);
+}
+
+/**
+ * Lazily removes duplicates from the input range using specified hash and equality functions,
+ * duplicates are discarded, see `distinct_range`.
+ *
+ * @param range source range
+ * @param hasher hash function
+ * @param equal key equality function
+ * @return distinct range
+ */
+template<typename Range, typename Hash, typename Eq>
+distinct_range<typename detail_refwrap::adapted<Range>::type,
+        detail_distinct::exact_keys<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>, Hash, Eq>,
+        detail_filter::offcaster<detail_distinct::elem_type<typename detail_refwrap::adapted<Range>::type>>>
+distinct(Range&& range, Hash hasher, Eq equal) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    return distinct(std::forward<Range>(range), std::move(hasher), std::move(equal),
+            detail_filter::offcaster<detail_distinct::elem_type<range_type>>());
+}
+
+/**
+ * Lazily removes duplicates from the input range using `std::hash` and `operator==`,
+ * duplicates are discarded, see `distinct_range`.
+ *
+ * @param range source range
+ * @return distinct range
+ */
+template<typename Range>
+distinct_range<typename detail_refwrap::adapted<Range>::type,
+        detail_distinct::exact_keys<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>,
+                std::hash<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>>,
+                std::equal_to<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>>>,
+        detail_filter::offcaster<detail_distinct::elem_type<typename detail_refwrap::adapted<Range>::type>>>
+distinct(Range&& range) {
+    using key_type = detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>;
+    return distinct(std::forward<Range>(range), std::hash<key_type>(), std::equal_to<key_type>());
+}
+
+/**
+ * Lazily removes duplicates from the input range keeping only the hashes of the seen elements,
+ * memory usage is one `std::size_t` (plus one control byte) per slot regardless of the element size.
+ * Elements with colliding hashes are treated as duplicates, so a small fraction of distinct elements
+ * may be offcast, the hash function should be of good quality and use all the bits of `std::size_t`.
+ * See `distinct_range`.
+ *
+ * @param range source range
+ * @param hasher hash function
+ * @param offcast_dest `FunctionObject` to apply duplicate elements to it
+ * @param capacity expected number of distinct elements, `0` (default) to use the size hint of the source
+ * @return distinct range
+ */
+template<typename Range, typename Hash, typename Dest>
+distinct_range<typename detail_refwrap::adapted<Range>::type,
+        detail_distinct::hashed_keys<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>, Hash>,
+        Dest>
+distinct_hashes(Range&& range, Hash hasher, Dest offcast_dest, std::size_t capacity = 0) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    using seen_type = detail_distinct::hashed_keys<detail_distinct::key_type<range_type>, Hash>;
+    return distinct_range<range_type, seen_type, Dest>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)),
+            seen_type(std::move(hasher)), std::move(offcast_dest), capacity);
+}
+
+/**
+ * Lazily removes duplicates from the input range keeping only the `std::hash` hashes
+ * of the seen elements, duplicates are discarded, see `distinct_hashes` above.
+ *
+ * @param range source range
+ * @return distinct range
+ */
+template<typename Range>
+distinct_range<typename detail_refwrap::adapted<Range>::type,
+        detail_distinct::hashed_keys<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>,
+                std::hash<detail_distinct::key_type<typename detail_refwrap::adapted<Range>::type>>>,
+        detail_filter::offcaster<detail_distinct::elem_type<typename detail_refwrap::adapted<Range>::type>>>
+distinct_hashes(Range&& range) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    using key_type = detail_distinct::key_type<range_type>;
+    return distinct_hashes(std::forward<Range>(range), std::hash<key_type>(),
+            detail_filter::offcaster<detail_distinct::elem_type<range_type>>());
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_DISTINCT_HPP */
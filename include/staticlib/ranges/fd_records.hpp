@@ -0,0 +1,226 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   fd_records.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 12:10 AM
+ */
+
+#ifndef STATICLIB_RANGES_FD_RECORDS_HPP
+#define STATICLIB_RANGES_FD_RECORDS_HPP
+
+// file descriptor sources are available only on POSIX platforms
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/record_view.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Streaming source range, that reads delimiter-separated records (lines by default)
+ * from the specified file descriptor (pipe, FIFO, socket, stdin) and yields them
+ * as `record_view` slices of the internal buffer. Data is read with `read(2)`
+ * in large blocks into a single reused buffer, so no memory is allocated per record.
+ * Only the incomplete record at the end of the buffer is moved to the buffer start
+ * before the next read, buffer is enlarged only for records longer than it.
+ * Delimiters are not included into records, last record is returned even if
+ * it does not end with delimiter.
+ *
+ * Returned views remain valid only until the next increment.
+ * File descriptor is NOT owned by this range and is not closed.
+ */
+class fd_records : public range_adapter<fd_records, record_view> {
+    int fd;
+    char delimiter;
+    std::vector<char> buffer;
+    // start of the next record
+    std::size_t start = 0;
+    // number of bytes of the next record, that are known to not contain delimiter
+    std::size_t scanned = 0;
+    std::size_t filled = 0;
+    bool eof = false;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param fd file descriptor to read from
+     * @param delimiter records delimiter
+     * @param block_size initial buffer size, max number of bytes to read with a single call
+     */
+    fd_records(int fd, char delimiter = '\n', std::size_t block_size = 65536) :
+    fd(fd),
+    delimiter(delimiter),
+    buffer(block_size > 0 ? block_size : 1) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    fd_records(const fd_records& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    fd_records& operator=(const fd_records& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    fd_records(fd_records&& other) :
+    range_adapter<fd_records, record_view>(std::move(other)),
+    fd(other.fd),
+    delimiter(other.delimiter),
+    buffer(std::move(other.buffer)),
+    start(other.start),
+    scanned(other.scanned),
+    filled(other.filled),
+    eof(other.eof) {
+        other.fd = -1;
+        other.eof = true;
+        other.start = 0;
+        other.filled = 0;
+    }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    fd_records& operator=(fd_records&& other) = delete;
+
+    /**
+     * Finds the next record, reads more data if necessary
+     *
+     * @return true if next record exists, false (range exhausted) otherwise
+     * @throws std::runtime_error on read error
+     */
+    bool compute_next() {
+        record_view rec;
+        if (next_record(rec)) {
+            return set_current(std::move(rec));
+        }
+        return false;
+    }
+
+    /**
+     * Pushes all the remaining records into the specified sink,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push records into
+     * @return false if iteration was stopped by sink, true otherwise
+     * @throws std::runtime_error on read error
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        record_view rec;
+        while (next_record(rec)) {
+            if (!sink(std::move(rec))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    bool next_record(record_view& rec) {
+        for (;;) {
+            std::size_t from = start + scanned;
+            if (from < filled) {
+                const char* begin = buffer.data() + from;
+                const void* found = std::memchr(begin, delimiter, filled - from);
+                if (nullptr != found) {
+                    std::size_t end = from + static_cast<std::size_t>(static_cast<const char*>(found) - begin);
+                    rec = record_view(buffer.data() + start, end - start);
+                    this->start = end + 1;
+                    this->scanned = 0;
+                    return true;
+                }
+                this->scanned = filled - start;
+            }
+            if (eof) {
+                if (start < filled) {
+                    rec = record_view(buffer.data() + start, filled - start);
+                    this->start = filled;
+                    this->scanned = 0;
+                    return true;
+                }
+                return false;
+            }
+            read_block();
+        }
+    }
+
+    void read_block() {
+        if (start == filled) {
+            this->start = 0;
+            this->filled = 0;
+        } else if (filled == buffer.size()) {
+            if (start > 0) {
+                // carry over incomplete record
+                std::memmove(buffer.data(), buffer.data() + start, filled - start);
+                this->filled -= start;
+                this->start = 0;
+            } else {
+                // record is longer than buffer
+                buffer.resize(buffer.size() * 2);
+            }
+        }
+        for (;;) {
+            auto res = ::read(fd, buffer.data() + filled, buffer.size() - filled);
+            if (res > 0) {
+                this->filled += static_cast<std::size_t>(res);
+                return;
+            }
+            if (0 == res) {
+                this->eof = true;
+                return;
+            }
+            if (EINTR != errno) {
+                throw std::runtime_error(std::string("Error reading from file descriptor,") +
+                        " fd: [" + std::to_string(fd) + "], error: [" + std::strerror(errno) + "]");
+            }
+        }
+    }
+};
+
+} // namespace
+}
+
+#endif // POSIX
+
+#endif /* STATICLIB_RANGES_FD_RECORDS_HPP */
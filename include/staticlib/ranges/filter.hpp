@@ -25,13 +25,18 @@
 #define STATICLIB_RANGES_FILTER_HPP
 
 #include <array>
+#include <cstddef>
 #include <iterator>
+#include <memory>
 #include <functional>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/parallel.hpp"
 #include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
 #include "staticlib/ranges/traits.hpp"
 
 namespace staticlib {
@@ -39,11 +44,50 @@ namespace ranges {
 
 namespace detail_filter {
 
+// dispatch priorities, offcast destinations with `flush()` (e.g. `offcast_batch`) are flushed
+struct fallback { };
+struct own : fallback { };
+
+template<typename Dest>
+auto flush_offcast(Dest& dest, own) -> decltype(dest.flush(), void()) {
+    dest.flush();
+}
+
+template<typename Dest>
+void flush_offcast(Dest&, fallback) {
+    // nothing to flush
+}
+
+/**
+ * Type trait to detect offcast destinations without state (discarding `offcaster`,
+ * function pointers like `ignore_offcast` and lambdas without captures), only such
+ * destinations can be called from multiple threads without sharing a target
+ * container (e.g. `offcast_into`) or buffer (e.g. `offcast_batch`) between them
+ */
+template<typename Dest>
+struct is_stateless_offcast {
+    static const bool value = std::is_empty<Dest>::value ||
+            std::is_function<typename std::remove_pointer<Dest>::type>::value;
+};
+
+/**
+ * Type trait to detect filtered ranges, that can be pushed to sinks in slices:
+ * source range is sliceable and offcast destination has no state
+ */
+template<typename Range, typename Dest>
+struct is_sliceable {
+    static const bool value = detail_fusion::is_sliceable<Range>::value &&
+            is_stateless_offcast<Dest>::value;
+};
+
 /**
  * Lazy `InputIterator` implementation for `filter`  operation.
  * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
- * Moves element from source iterator, checks it against specified `Predicate`
- * and on success moves it out from `operator*` method.
+ * When source iterator returns elements by reference, checks them against
+ * specified `Predicate` in place and moves matched elements out from `operator*`
+ * method directly from source. Otherwise moves element from source iterator
+ * into the iterator, checks it against specified `Predicate` and on success moves
+ * it out from `operator*` method.
  * Elements, that do not match predicate will be applied to specified `FunctionObject`.
  */
 template <typename Iter, typename Elem, typename Pred, typename Dest>
@@ -56,6 +100,13 @@ class filtered_iter {
     // space in iter for placement of Elem instance (to not require DefaultConstructible)
     typename std::aligned_storage<sizeof(Elem), std::alignment_of<Elem>::value>::type current_space;
     Elem* current_ptr = nullptr;
+
+    // whether predicate can be checked against the source element in place,
+    // elements must be returned by non-const reference to be moved from
+    using in_place = std::integral_constant<bool,
+            std::is_lvalue_reference<decltype(*std::declval<Iter&>())>::value &&
+            !std::is_const<typename std::remove_reference<decltype(*std::declval<Iter&>())>::type>::value &&
+            std::is_same<typename std::decay<decltype(*std::declval<Iter&>())>::type, Elem>::value>;
     
 public:
     using value_type = Elem;
@@ -79,13 +130,7 @@ public:
     source_iter_end(std::move(source_iter_end)),
     predicate(&predicate),
     offcast_dest(&offcast_dest) {
-        if (this->source_iter != this->source_iter_end) {
-            this->current_ptr = new (std::addressof(current_space)) Elem(std::move(*this->source_iter));
-            if (!(*this->predicate)(*current_ptr)) {
-                (*this->offcast_dest)(std::move(*current_ptr));
-                next();
-            }
-        }
+        init(in_place());
     }
     
     /**
@@ -130,7 +175,11 @@ public:
         this->predicate = std::move(other.predicate);
         this->offcast_dest = std::move(other.offcast_dest);
         if (other.current_ptr) {
-            *this->current_ptr = std::move(*other.current_ptr);
+            if (this->current_ptr) {
+                *this->current_ptr = std::move(*other.current_ptr);
+            } else {
+                this->current_ptr = new (std::addressof(current_space)) Elem(std::move(*other.current_ptr));
+            }
         }
         return *this;
     }
@@ -152,7 +201,7 @@ public:
      * @return reference to this iterator
      */
     filtered_iter& operator++() {
-        next();
+        next(in_place());
         return *this;
     }
 
@@ -164,7 +213,7 @@ public:
      * @return reference to this iterator
      */
     filtered_iter& operator++(int) {
-        next();
+        next(in_place());
         return *this;
     }
     
@@ -174,7 +223,7 @@ public:
      * @return current element
      */
     Elem operator*() {
-        return std::move(*current_ptr);
+        return current(in_place());
     }
 
     /**
@@ -189,17 +238,103 @@ public:
     }
 
 private:
-    void next() {
+    void init(std::true_type) {
+        skip_offcast();
+    }
+
+    void init(std::false_type) {
+        if (this->source_iter != this->source_iter_end) {
+            this->current_ptr = new (std::addressof(current_space)) Elem(std::move(*this->source_iter));
+            if (!(*this->predicate)(*current_ptr)) {
+                (*this->offcast_dest)(std::move(*current_ptr));
+                next(std::false_type());
+            }
+        }
+    }
+
+    void next(std::true_type) {
+        ++source_iter;
+        skip_offcast();
+    }
+
+    void next(std::false_type) {
         for (++source_iter; source_iter != source_iter_end; ++source_iter) {
             *current_ptr = std::move(*source_iter);
             auto& ref = *current_ptr;
             if ((*predicate)(ref)) break;
             (*offcast_dest)(std::move(*current_ptr));
         }
+        flush_if_exhausted();
+    }
+
+    // offcast elements are moved exactly once, straight from the source
+    void skip_offcast() {
+        for (; source_iter != source_iter_end; ++source_iter) {
+            auto& ref = *source_iter;
+            if ((*predicate)(ref)) break;
+            (*offcast_dest)(std::move(ref));
+        }
+        flush_if_exhausted();
+    }
+
+    // buffered offcast elements are delivered as soon as the source is exhausted
+    void flush_if_exhausted() {
+        if (!(source_iter != source_iter_end)) {
+            flush_offcast(*offcast_dest, own());
+        }
+    }
+
+    Elem current(std::true_type) {
+        return std::move(*source_iter);
+    }
+
+    Elem current(std::false_type) {
+        return std::move(*current_ptr);
     }
     
 };
 
+/**
+ * Sink that checks each element against `Predicate` and pushes matched
+ * elements to the next sink, other elements are applied to offcast `FunctionObject`.
+ */
+template<typename Pred, typename Dest, typename Sink>
+class filtering_sink {
+    Pred* predicate;
+    Dest* offcast_dest;
+    Sink* next;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param predicate filtering `Predicate`
+     * @param offcast_dest `FunctionObject` for offcast elements
+     * @param next next sink
+     */
+    filtering_sink(Pred& predicate, Dest& offcast_dest, Sink& next) :
+    predicate(std::addressof(predicate)),
+    offcast_dest(std::addressof(offcast_dest)),
+    next(std::addressof(next)) { }
+
+    /**
+     * Checks specified element against the predicate (in place, without moving it)
+     * and pushes it either to the next sink or to the offcast destination
+     *
+     * @param el element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        if ((*predicate)(ref)) {
+            return (*next)(std::move(el));
+        }
+        (*offcast_dest)(std::move(el));
+        return true;
+    }
+};
+
 /**
  * Helper template to be used with
  * reference input range when filtered out elements
@@ -224,7 +359,8 @@ public:
  * Lazy implementation of `SinglePassRange` for `filter`  operation, 
  * after the pass all accessed elements of source range will be moved from
  * (will retain in "valid but unspecified" state). Elements that won't match the 
- * `Predicate` will be applied to specified `FunctionObject`
+ * `Predicate` will be applied to specified `FunctionObject`, offcast `FunctionObject`
+ * with `flush()` method (e.g. `offcast_batch`) is flushed when the source range is exhausted.
  */
 template <typename Range, typename Pred, typename Dest>
 class filtered_range {
@@ -311,6 +447,63 @@ public:
         };
     }
 
+    /**
+     * Returns size hint of this range, size of the source range
+     * is used as an upper bound
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range).as_upper_bound();
+    }
+
+    /**
+     * Pushes all the elements of the source range that match the predicate
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        auto stage = detail_filter::filtering_sink<Pred, Dest, Sink>(predicate, offcast_dest, sink);
+        bool res = staticlib::ranges::fused_for_each(source_range, stage);
+        if (res) {
+            detail_filter::flush_offcast(offcast_dest, detail_filter::own());
+        }
+        return res;
+    }
+
+    /**
+     * Returns the size of the innermost random-access source range,
+     * available only for sliceable source ranges and offcast
+     * destinations without state
+     *
+     * @return size of the innermost source range
+     */
+    template<typename R = Range, typename D = Dest,
+            class = typename std::enable_if<detail_filter::is_sliceable<R, D>::value>::type>
+    std::size_t slice_size() const {
+        return detail_fusion::get_slice_size(source_range);
+    }
+
+    /**
+     * Pushes elements, produced from the elements of the innermost random-access
+     * source range with indices `[from, to)`, that match the predicate into the specified sink,
+     * available only for sliceable source ranges and offcast destinations without state
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @param from index of the first source element
+     * @param to index past the last source element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink, typename R = Range, typename D = Dest,
+            class = typename std::enable_if<detail_filter::is_sliceable<R, D>::value>::type>
+    bool fused_for_each_slice(Sink& sink, std::size_t from, std::size_t to) {
+        auto stage = detail_filter::filtering_sink<Pred, Dest, Sink>(predicate, offcast_dest, sink);
+        return detail_fusion::fused_for_each_slice(source_range, stage, from, to);
+    }
+
     /**
      * Process this range eagerly returning results as 
      * a newly-allocated vector.
@@ -318,11 +511,52 @@ public:
      * @return vector with processed elements
      */
     std::vector<value_type> to_vector() {
-        std::vector<value_type> vec;
-        for (auto&& el : *this) {
-            vec.emplace_back(std::move(el));
-        }
-        return vec;
+        return detail_fusion::collect(*this, std::vector<value_type>());
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        return detail_fusion::collect_allocated<value_type>(*this, alloc);
+    }
+
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
+
+    /**
+     * Process this range eagerly using multiple threads returning results
+     * as a newly-allocated vector, order of the elements is preserved.
+     * Only ranges over random-access sources are processed in parallel,
+     * all other ranges are processed sequentially, see `parallel_policy`.
+     * Ranges with offcast destinations, that have state (e.g. `offcast_into`,
+     * `offcast_batch` or capturing lambdas), are also processed sequentially.
+     * Matched elements are collected into per-thread buffers that are
+     * concatenated after all threads are finished.
+     *
+     * @param policy parallel execution policy
+     * @return vector with processed elements
+     */
+    std::vector<value_type> to_vector(const parallel_policy& policy) {
+        return detail_parallel::to_vector<value_type>(*this, policy,
+                std::integral_constant<bool, detail_filter::is_sliceable<Range, Dest>::value>());
     }
 };
 
@@ -0,0 +1,628 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   flat_hash.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 9:10 AM
+ */
+
+#ifndef STATICLIB_RANGES_FLAT_HASH_HPP
+#define STATICLIB_RANGES_FLAT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_flat_hash {
+
+// control byte of the empty slot, full slots have the highest bit set
+// and keep 7 bits of the hash to skip most of the key comparisons
+const unsigned char empty_ctrl = 0;
+
+inline unsigned char full_ctrl(std::size_t hash) {
+    return static_cast<unsigned char>(0x80 | (hash & 0x7f));
+}
+
+/**
+ * Forward iterator over the full slots of the flat hash table
+ */
+template<typename Map, typename Entry>
+class entry_iter {
+    Map* map;
+    std::size_t idx;
+
+public:
+    using value_type = typename std::remove_const<Entry>::type;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Entry*;
+    using reference = Entry&;
+
+    entry_iter(Map* map, std::size_t idx) :
+    map(map),
+    idx(idx) {
+        skip_empty();
+    }
+
+    entry_iter& operator++() {
+        idx += 1;
+        skip_empty();
+        return *this;
+    }
+
+    entry_iter operator++(int) {
+        entry_iter res = *this;
+        ++*this;
+        return res;
+    }
+
+    Entry& operator*() const {
+        return map->entry(idx);
+    }
+
+    Entry* operator->() const {
+        return std::addressof(map->entry(idx));
+    }
+
+    bool operator==(const entry_iter& other) const {
+        return idx == other.idx;
+    }
+
+    bool operator!=(const entry_iter& other) const {
+        return idx != other.idx;
+    }
+
+private:
+    void skip_empty() {
+        while (idx < map->slots_count() && !map->is_full(idx)) {
+            idx += 1;
+        }
+    }
+};
+
+/**
+ * Entry traits for `flat_hash_map`, entries are key-value pairs,
+ * keys must not be modified in place, so they are copied on growth
+ */
+template<typename Key, typename Value>
+struct map_entry {
+    using type = std::pair<const Key, Value>;
+    using iterated_type = type;
+
+    static const Key& key(const type& entry) {
+        return entry.first;
+    }
+
+    template<typename K, typename... Args>
+    static void construct(void* place, K&& key, Args&&... args) {
+        new (place) type(std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    static void relocate(void* place, type& entry) {
+        // const key cannot be moved from, it is copied
+        new (place) type(entry.first, std::move(entry.second));
+    }
+};
+
+/**
+ * Entry traits for `flat_hash_set`, entries are keys
+ */
+template<typename Key>
+struct set_entry {
+    using type = Key;
+    // keys must not be modified in place
+    using iterated_type = const Key;
+
+    static const Key& key(const type& entry) {
+        return entry;
+    }
+
+    template<typename K>
+    static void construct(void* place, K&& key) {
+        new (place) type(std::forward<K>(key));
+    }
+
+    static void relocate(void* place, type& entry) {
+        new (place) type(std::move(entry));
+    }
+};
+
+/**
+ * Insert-only hash table with open addressing: entries are stored inline in a single
+ * array of slots, collisions are resolved with linear probing, capacity is a power of two
+ * and the table grows when load factor exceeds `0.75`. A separate array of control bytes
+ * keeps part of the hash of each entry, so probing rarely touches the keys of other entries.
+ * Hash values are mixed with Fibonacci hashing, so identity hashes (e.g. `std::hash<int>`)
+ * are spread over the table.
+ *
+ * Iterators and references to entries are invalidated on growth. Iteration order is unspecified.
+ */
+template<typename Entry, typename Key, typename Hash, typename Eq>
+class table {
+    template<typename Map, typename IterEntry>
+    friend class entry_iter;
+
+public:
+    /**
+     * Key type
+     */
+    using key_type = Key;
+
+    /**
+     * Entry type
+     */
+    using value_type = typename Entry::type;
+
+    /**
+     * Iterator type
+     */
+    using iterator = entry_iter<table, typename Entry::iterated_type>;
+
+    /**
+     * Const iterator type
+     */
+    using const_iterator = entry_iter<const table, const value_type>;
+
+private:
+    using slot_type = typename std::aligned_storage<sizeof(value_type), std::alignment_of<value_type>::value>::type;
+
+    std::unique_ptr<slot_type[]> slots;
+    std::unique_ptr<unsigned char[]> ctrl;
+    std::size_t capacity = 0;
+    std::size_t count = 0;
+    unsigned shift = 64;
+    Hash hasher;
+    Eq equal;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param expected_size number of entries to reserve space for
+     * @param hasher hash function
+     * @param equal key equality function
+     */
+    explicit table(std::size_t expected_size = 0, Hash hasher = Hash(), Eq equal = Eq()) :
+    hasher(std::move(hasher)),
+    equal(std::move(equal)) {
+        reserve(expected_size);
+    }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    table(const table& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    table& operator=(const table& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    table(table&& other) :
+    slots(std::move(other.slots)),
+    ctrl(std::move(other.ctrl)),
+    capacity(other.capacity),
+    count(other.count),
+    shift(other.shift),
+    hasher(std::move(other.hasher)),
+    equal(std::move(other.equal)) {
+        other.capacity = 0;
+        other.count = 0;
+        other.shift = 64;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    table& operator=(table&& other) {
+        if (this != std::addressof(other)) {
+            destroy_all();
+            this->slots = std::move(other.slots);
+            this->ctrl = std::move(other.ctrl);
+            this->capacity = other.capacity;
+            this->count = other.count;
+            this->shift = other.shift;
+            this->hasher = std::move(other.hasher);
+            this->equal = std::move(other.equal);
+            other.capacity = 0;
+            other.count = 0;
+            other.shift = 64;
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor, destroys all the entries
+     */
+    ~table() {
+        destroy_all();
+    }
+
+    /**
+     * Number of entries
+     *
+     * @return number of entries
+     */
+    std::size_t size() const {
+        return count;
+    }
+
+    /**
+     * Whether this table contains no entries
+     *
+     * @return true if table is empty
+     */
+    bool empty() const {
+        return 0 == count;
+    }
+
+    /**
+     * Reserves space, so the specified number of entries can be inserted
+     * without growing the table
+     *
+     * @param expected_size number of entries
+     * @throws std::length_error if the table of the required capacity cannot be addressed
+     */
+    void reserve(std::size_t expected_size) {
+        std::size_t required = min_capacity(expected_size);
+        if (required > capacity) {
+            rehash(required);
+        }
+    }
+
+    /**
+     * Inserts new entry constructed from the specified key and arguments,
+     * if the table does not contain specified key. Entry is not constructed
+     * if key is already present.
+     *
+     * @param key key
+     * @param args additional arguments for the entry constructor (value constructor for maps)
+     * @return pair of the iterator to the entry with specified key and the flag,
+     *         whether the entry was inserted
+     */
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplace(K&& key, Args&&... args) {
+        std::size_t hash = hasher(key);
+        std::size_t idx = find_index(key, hash);
+        if (idx < capacity) {
+            return std::make_pair(iterator(this, idx), false);
+        }
+        if (min_capacity(count + 1) > capacity) {
+            rehash(capacity > 0 ? capacity * 2 : 8);
+        }
+        idx = free_index(hash);
+        Entry::construct(std::addressof(slots[idx]), std::forward<K>(key), std::forward<Args>(args)...);
+        ctrl[idx] = full_ctrl(hash);
+        count += 1;
+        return std::make_pair(iterator(this, idx), true);
+    }
+
+    /**
+     * Finds the entry with specified key
+     *
+     * @param key key
+     * @return iterator to the found entry, `end()` if key is not present
+     */
+    iterator find(const Key& key) {
+        return iterator(this, find_index(key, hasher(key)));
+    }
+
+    /**
+     * Finds the entry with specified key
+     *
+     * @param key key
+     * @return iterator to the found entry, `end()` if key is not present
+     */
+    const_iterator find(const Key& key) const {
+        return const_iterator(this, find_index(key, hasher(key)));
+    }
+
+    /**
+     * Whether this table contains specified key
+     *
+     * @param key key
+     * @return true if key is present
+     */
+    bool contains(const Key& key) const {
+        return find_index(key, hasher(key)) < capacity;
+    }
+
+    /**
+     * Removes all the entries, keeps allocated space
+     */
+    void clear() {
+        destroy_all();
+    }
+
+    /**
+     * Returns iterator to the first entry
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(this, capacity);
+    }
+
+    /**
+     * Returns iterator to the first entry
+     *
+     * @return `begin` iterator
+     */
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    const_iterator end() const {
+        return const_iterator(this, capacity);
+    }
+
+private:
+    static std::size_t min_capacity(std::size_t size) {
+        if (0 == size) {
+            return 0;
+        }
+        // highest power of two, that fits into size_t
+        const std::size_t max_capacity = (std::numeric_limits<std::size_t>::max() >> 1) + 1;
+        if (size > max_capacity / 4 * 3) {
+            throw std::length_error("Invalid hash table size requested, size: [" + std::to_string(size) + "]");
+        }
+        // max load factor 0.75
+        std::size_t required = size + (size + 2) / 3;
+        std::size_t res = 8;
+        while (res < required) {
+            res <<= 1;
+        }
+        return res;
+    }
+
+    std::size_t slots_count() const {
+        return capacity;
+    }
+
+    bool is_full(std::size_t idx) const {
+        return empty_ctrl != ctrl[idx];
+    }
+
+    value_type& entry(std::size_t idx) {
+        return *reinterpret_cast<value_type*>(std::addressof(slots[idx]));
+    }
+
+    const value_type& entry(std::size_t idx) const {
+        return *reinterpret_cast<const value_type*>(std::addressof(slots[idx]));
+    }
+
+    std::size_t home_index(std::size_t hash) const {
+        // Fibonacci hashing, takes the highest bits of the product
+        return static_cast<std::size_t>((static_cast<uint64_t>(hash) * UINT64_C(0x9E3779B97F4A7C15)) >> shift);
+    }
+
+    template<typename K>
+    std::size_t find_index(const K& key, std::size_t hash) const {
+        if (0 == count) {
+            return capacity;
+        }
+        std::size_t mask = capacity - 1;
+        unsigned char expected = full_ctrl(hash);
+        for (std::size_t idx = home_index(hash);; idx = (idx + 1) & mask) {
+            unsigned char cb = ctrl[idx];
+            if (empty_ctrl == cb) {
+                return capacity;
+            }
+            if (expected == cb && equal(Entry::key(entry(idx)), key)) {
+                return idx;
+            }
+        }
+    }
+
+    std::size_t free_index(std::size_t hash) const {
+        std::size_t mask = capacity - 1;
+        std::size_t idx = home_index(hash);
+        while (is_full(idx)) {
+            idx = (idx + 1) & mask;
+        }
+        return idx;
+    }
+
+    void rehash(std::size_t new_capacity) {
+        auto old_slots = std::move(slots);
+        auto old_ctrl = std::move(ctrl);
+        std::size_t old_capacity = capacity;
+        this->slots.reset(new slot_type[new_capacity]);
+        this->ctrl.reset(new unsigned char[new_capacity]());
+        this->capacity = new_capacity;
+        this->shift = 64;
+        for (std::size_t cap = new_capacity; cap > 1; cap >>= 1) {
+            this->shift -= 1;
+        }
+        for (std::size_t i = 0; i < old_capacity; i++) {
+            if (empty_ctrl != old_ctrl[i]) {
+                auto& el = *reinterpret_cast<value_type*>(std::addressof(old_slots[i]));
+                std::size_t hash = hasher(Entry::key(el));
+                std::size_t idx = free_index(hash);
+                Entry::relocate(std::addressof(slots[idx]), el);
+                ctrl[idx] = full_ctrl(hash);
+                el.~value_type();
+            }
+        }
+    }
+
+    void destroy_all() {
+        for (std::size_t i = 0; i < capacity && count > 0; i++) {
+            if (is_full(i)) {
+                entry(i).~value_type();
+                ctrl[i] = empty_ctrl;
+                count -= 1;
+            }
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * Insert-only hash map with open addressing, key-value pairs are stored inline
+ * in the slots of the table, see `detail_flat_hash::table` for details.
+ * Keys must be `CopyConstructible`, they are copied when table grows.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+class flat_hash_map : public detail_flat_hash::table<detail_flat_hash::map_entry<Key, Value>, Key, Hash, Eq> {
+    using table_type = detail_flat_hash::table<detail_flat_hash::map_entry<Key, Value>, Key, Hash, Eq>;
+
+public:
+    /**
+     * Mapped value type
+     */
+    using mapped_type = Value;
+
+    /**
+     * Constructor
+     *
+     * @param expected_size number of entries to reserve space for
+     * @param hasher hash function
+     * @param equal key equality function
+     */
+    explicit flat_hash_map(std::size_t expected_size = 0, Hash hasher = Hash(), Eq equal = Eq()) :
+    table_type(expected_size, std::move(hasher), std::move(equal)) { }
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    flat_hash_map(flat_hash_map&& other) :
+    table_type(std::move(other)) { }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flat_hash_map& operator=(flat_hash_map&& other) {
+        table_type::operator=(std::move(other));
+        return *this;
+    }
+
+    /**
+     * Access to the value with the specified key, value-initialized
+     * value is inserted if key is not present
+     *
+     * @param key key
+     * @return reference to value
+     */
+    template<typename K>
+    Value& operator[](K&& key) {
+        return this->emplace(std::forward<K>(key)).first->second;
+    }
+};
+
+/**
+ * Insert-only hash set with open addressing, keys are stored inline
+ * in the slots of the table, see `detail_flat_hash::table` for details.
+ */
+template<typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+class flat_hash_set : public detail_flat_hash::table<detail_flat_hash::set_entry<Key>, Key, Hash, Eq> {
+    using table_type = detail_flat_hash::table<detail_flat_hash::set_entry<Key>, Key, Hash, Eq>;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param expected_size number of keys to reserve space for
+     * @param hasher hash function
+     * @param equal key equality function
+     */
+    explicit flat_hash_set(std::size_t expected_size = 0, Hash hasher = Hash(), Eq equal = Eq()) :
+    table_type(expected_size, std::move(hasher), std::move(equal)) { }
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    flat_hash_set(flat_hash_set&& other) :
+    table_type(std::move(other)) { }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flat_hash_set& operator=(flat_hash_set&& other) {
+        table_type::operator=(std::move(other));
+        return *this;
+    }
+
+    /**
+     * Inserts specified key, if it is not already present
+     *
+     * @param key key
+     * @return true if key was inserted, false if it was already present
+     */
+    template<typename K>
+    bool insert(K&& key) {
+        return this->emplace(std::forward<K>(key)).second;
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_FLAT_HASH_HPP */
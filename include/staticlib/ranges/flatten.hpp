@@ -0,0 +1,473 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   flatten.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 7:30 PM
+ */
+
+#ifndef STATICLIB_RANGES_FLATTEN_HPP
+#define STATICLIB_RANGES_FLATTEN_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_flatten {
+
+/**
+ * Space for placement of a single instance (to not require DefaultConstructible),
+ * destroys placed instance on reset and on destruction
+ */
+template<typename T>
+class slot {
+    typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type space;
+    T* ptr = nullptr;
+
+public:
+    slot() { }
+
+    slot(const slot&) = delete;
+
+    slot& operator=(const slot&) = delete;
+
+    ~slot() {
+        reset();
+    }
+
+    template<typename Arg>
+    T& emplace(Arg&& arg) {
+        reset();
+        this->ptr = new (std::addressof(space)) T(std::forward<Arg>(arg));
+        return *ptr;
+    }
+
+    void reset() {
+        if (ptr) {
+            ptr->~T();
+            ptr = nullptr;
+        }
+    }
+
+    bool has_value() const {
+        return nullptr != ptr;
+    }
+
+    T& get() {
+        return *ptr;
+    }
+};
+
+/**
+ * Type of the inner range, that is created from the outer element:
+ * elements themselves are used as inner ranges
+ */
+template<typename OuterElem>
+struct inner_range {
+    using type = OuterElem;
+
+    static type make(OuterElem&& el) {
+        return std::move(el);
+    }
+};
+
+/**
+ * Type of the inner range, that is created from the outer element:
+ * `std::reference_wrapper` elements are wrapped with `refwrap`
+ */
+template<typename T>
+struct inner_range<std::reference_wrapper<T>> {
+    using type = decltype(staticlib::ranges::refwrap(std::declval<T&>()));
+
+    static type make(std::reference_wrapper<T>&& el) {
+        return staticlib::ranges::refwrap(el.get());
+    }
+};
+
+/**
+ * Lazy `InputIterator` implementation for `flatten` operation.
+ * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Holds a pointer to the parent range that keeps the iteration state.
+ */
+template<typename Range>
+class flattened_iter {
+    Range* range;
+
+public:
+    using value_type = typename Range::value_type;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param range parent range, `nullptr` for "past the end" iterator
+     */
+    flattened_iter(Range* range) :
+    range(range) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    flattened_iter(const flattened_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flattened_iter& operator=(const flattened_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    flattened_iter(flattened_iter&& other) :
+    range(other.range) {
+        other.range = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flattened_iter& operator=(flattened_iter&& other) {
+        this->range = other.range;
+        other.range = nullptr;
+        return *this;
+    }
+
+    /**
+     * Increments inner iterator, switches to the next outer element
+     * when inner range is exhausted
+     *
+     * @return reference to iter instance
+     */
+    flattened_iter& operator++() {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Increments inner iterator, switches to the next outer element
+     * when inner range is exhausted
+     *
+     * @return reference to iter instance
+     */
+    flattened_iter& operator++(int) {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Will move out current element of the inner range
+     *
+     * @return current element
+     */
+    value_type operator*() {
+        if (range) {
+            return range->current_element();
+        } else {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+    }
+
+    /**
+     * Compares this iterator instance with a "past the end"
+     * Does NOT support arbitrary input instances,
+     * should be used only to compare with "past the end" iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const flattened_iter& end) const {
+        return (this->range && !this->range->exhausted()) ||
+                (end.range && !end.range->exhausted());
+    }
+};
+
+/**
+ * Sink that creates inner range from each outer element and
+ * pushes all its elements to the next sink
+ */
+template<typename Inner, typename Sink>
+class flattening_sink {
+    Sink* next;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param next next sink
+     */
+    flattening_sink(Sink& next) :
+    next(std::addressof(next)) { }
+
+    /**
+     * Pushes all elements of the inner range created from
+     * the specified outer element to the next sink
+     *
+     * @param el outer element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto inner = Inner::make(std::move(el));
+        return staticlib::ranges::fused_for_each(inner, *next);
+    }
+};
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for `flatten` operation,
+ * after the pass all accessed elements of source range and of inner ranges
+ * will be moved from (will retain in "valid but unspecified" state).
+ * Current inner range is owned by this range, the next outer element
+ * is accessed only after the current inner range is exhausted.
+ * Range must not be moved after `begin()` is called.
+ */
+template<typename Range>
+class flattened_range {
+    friend class detail_flatten::flattened_iter<flattened_range>;
+
+    using outer_iterator = decltype(std::declval<Range&>().begin());
+    using outer_elem = typename std::decay<decltype(*std::declval<outer_iterator&>())>::type;
+    using inner_maker = detail_flatten::inner_range<outer_elem>;
+    using inner_type = typename inner_maker::type;
+    using inner_iterator = decltype(std::declval<inner_type&>().begin());
+
+    Range source_range;
+    detail_flatten::slot<outer_iterator> outer_iter;
+    detail_flatten::slot<outer_iterator> outer_iter_end;
+    detail_flatten::slot<inner_type> inner;
+    detail_flatten::slot<inner_iterator> inner_iter;
+    detail_flatten::slot<inner_iterator> inner_iter_end;
+
+public:
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = typename std::decay<decltype(*std::declval<inner_iterator&>())>::type;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_flatten::flattened_iter<flattened_range>;
+
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range of ranges
+     */
+    flattened_range(Range&& source_range) :
+    source_range(std::move(source_range)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    flattened_range(const flattened_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flattened_range& operator=(const flattened_range& other) = delete;
+
+    /**
+     * Move constructor, must not be used after `begin()` is called
+     * on other instance
+     *
+     * @param other other instance
+     */
+    flattened_range(flattened_range&& other) :
+    source_range(std::move(other.source_range)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    flattened_range& operator=(flattened_range&& other) = delete;
+
+    /**
+     * Returns `begin` iterator, positions it at the first element
+     * of the first non-empty inner range
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        reset_inner();
+        outer_iter.emplace(source_range.begin());
+        outer_iter_end.emplace(source_range.end());
+        find_element();
+        return iterator(this);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    /**
+     * Pushes all the elements of all inner ranges into the specified sink,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        auto stage = detail_flatten::flattening_sink<inner_maker, Sink>(sink);
+        return staticlib::ranges::fused_for_each(source_range, stage);
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector.
+     *
+     * @return vector with processed elements
+     */
+    std::vector<value_type> to_vector() {
+        return detail_fusion::collect(*this, std::vector<value_type>());
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        return detail_fusion::collect_allocated<value_type>(*this, alloc);
+    }
+
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
+
+private:
+    bool exhausted() const {
+        return !inner_iter.has_value();
+    }
+
+    value_type current_element() {
+        return std::move(*inner_iter.get());
+    }
+
+    void next_element() {
+        if (inner_iter.has_value()) {
+            ++inner_iter.get();
+            find_element();
+        }
+    }
+
+    void find_element() {
+        for (;;) {
+            if (inner_iter.has_value() && inner_iter.get() != inner_iter_end.get()) {
+                return;
+            }
+            reset_inner();
+            if (!outer_iter.has_value() || !(outer_iter.get() != outer_iter_end.get())) {
+                return;
+            }
+            auto& in = inner.emplace(inner_maker::make(std::move(*outer_iter.get())));
+            ++outer_iter.get();
+            inner_iter.emplace(in.begin());
+            inner_iter_end.emplace(in.end());
+        }
+    }
+
+    void reset_inner() {
+        inner_iter.reset();
+        inner_iter_end.reset();
+        inner.reset();
+    }
+};
+
+/**
+ * Lazily flattens input range of ranges (e.g. containers) into output range
+ * of the elements of inner ranges. Outer elements are moved from source range
+ * one by one, inner ranges are created lazily after the previous one is exhausted.
+ * All accessed elements will be left in "valid but unspecified state".
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference
+ * (inner ranges are iterated with `refwrap` in this case).
+ *
+ * @param range source range of ranges
+ * @return flattened range
+ */
+template<typename Range>
+flattened_range<typename detail_refwrap::adapted<Range>::type> flatten(Range&& range) {
+    return flattened_range<typename detail_refwrap::adapted<Range>::type>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_FLATTEN_HPP */
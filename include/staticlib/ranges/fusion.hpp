@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   fusion.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 1:05 PM
+ */
+
+#ifndef STATICLIB_RANGES_FUSION_HPP
+#define STATICLIB_RANGES_FUSION_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_fusion {
+
+// dispatch priorities, range's own fused implementation is preferred to iteration
+struct fallback { };
+struct own : fallback { };
+
+template<typename Range, typename Sink>
+auto for_each(Range& range, Sink& sink, own) -> decltype(range.fused_for_each(sink)) {
+    return range.fused_for_each(sink);
+}
+
+template<typename Range, typename Sink>
+bool for_each(Range& range, Sink& sink, fallback) {
+    for (auto&& el : range) {
+        if (!sink(std::move(el))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Range>
+auto slice_size(const Range& range, own) -> decltype(range.slice_size()) {
+    return range.slice_size();
+}
+
+template<typename Range, class = typename std::enable_if<
+        is_random_access_iterator<decltype(std::declval<Range&>().begin())>::value>::type>
+auto slice_size(const Range& range, fallback) -> decltype(static_cast<std::size_t>(range.size())) {
+    return static_cast<std::size_t>(range.size());
+}
+
+template<typename Range, typename Sink>
+auto for_each_slice(Range& range, Sink& sink, std::size_t from, std::size_t to, own) ->
+        decltype(range.fused_for_each_slice(sink, from, to)) {
+    return range.fused_for_each_slice(sink, from, to);
+}
+
+template<typename Range, typename Sink>
+bool for_each_slice(Range& range, Sink& sink, std::size_t from, std::size_t to, fallback) {
+    using diff_type = typename std::iterator_traits<decltype(range.begin())>::difference_type;
+    auto it = range.begin() + static_cast<diff_type>(from);
+    auto end = range.begin() + static_cast<diff_type>(to);
+    for (; it != end; ++it) {
+        if (!sink(std::move(*it))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Type trait to detect ranges, that can be pushed to sinks in slices
+ * of the innermost random-access source range, negative case
+ */
+template<typename Range, typename = void>
+struct is_sliceable : std::false_type { };
+
+/**
+ * Type trait to detect ranges, that can be pushed to sinks in slices
+ * of the innermost random-access source range, positive case
+ */
+template<typename Range>
+struct is_sliceable<Range, decltype(slice_size(std::declval<const Range&>(), own()), void())> : std::true_type { };
+
+/**
+ * Returns the size of the innermost random-access source range
+ *
+ * @param range sliceable range
+ * @return size of the innermost source range
+ */
+template<typename Range>
+std::size_t get_slice_size(const Range& range) {
+    return slice_size(range, own());
+}
+
+/**
+ * Pushes elements of the specified range, that are produced from the elements
+ * of innermost random-access source range with indices `[from, to)`, into the sink.
+ *
+ * @param range sliceable range
+ * @param sink `FunctionObject` to push elements into
+ * @param from index of the first source element
+ * @param to index past the last source element
+ * @return false if iteration was stopped by sink, true otherwise
+ */
+template<typename Range, typename Sink>
+bool fused_for_each_slice(Range& range, Sink& sink, std::size_t from, std::size_t to) {
+    return for_each_slice(range, sink, from, to, own());
+}
+
+/**
+ * Sink that emplaces all the elements into destination container
+ */
+template<typename Container>
+class emplacing_sink {
+    Container* dest;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param dest destination container
+     */
+    emplacing_sink(Container& dest) :
+    dest(std::addressof(dest)) { }
+
+    /**
+     * Emplaces specified element into destination container
+     *
+     * @param el element
+     * @return true
+     */
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        dest->emplace_back(std::move(el));
+        return true;
+    }
+};
+
+/**
+ * Moves all the elements from the specified range into the specified vector,
+ * reserving the space for them using the size hint of the range
+ *
+ * @param range input range
+ * @param vec destination vector
+ * @return destination vector
+ */
+template<typename Vector, typename Range>
+Vector collect(Range& range, Vector vec) {
+    reserve_for(vec, get_size_hint(range));
+    auto sink = emplacing_sink<Vector>(vec);
+    for_each(range, sink, own());
+    return vec;
+}
+
+/**
+ * Moves all the elements from the specified range into a vector,
+ * that uses specified allocator for its storage
+ *
+ * @param range input range
+ * @param alloc allocator, rebound to the element type
+ * @return vector containing all element from specified range
+ */
+template<typename Elem, typename Range, typename Alloc>
+typename allocated_vector<Elem, Alloc>::type collect_allocated(Range& range, const Alloc& alloc) {
+    using vector_type = typename allocated_vector<Elem, Alloc>::type;
+    return collect(range, vector_type(typename vector_type::allocator_type(alloc)));
+}
+
+} // namespace
+
+/**
+ * Pushes all the elements of the specified range into the sink.
+ *
+ * Ranges from this library implement this operation through `fused_for_each` method,
+ * in that case all the operations of the nested wrappers (e.g. `transform` inside `filter`
+ * inside `transform`) are applied inline inside a single loop over the innermost source
+ * range, without going through the chain of nested iterators. Other ranges are iterated
+ * using their iterators.
+ *
+ * Sink is a `FunctionObject` that takes each element as an `rvalue` and returns `false`
+ * to stop the iteration.
+ *
+ * @param range input range
+ * @param sink `FunctionObject` to push elements into
+ * @return false if iteration was stopped by sink, true otherwise
+ */
+template<typename Range, typename Sink>
+bool fused_for_each(Range& range, Sink& sink) {
+    return detail_fusion::for_each(range, sink, detail_fusion::own());
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_FUSION_HPP */
@@ -0,0 +1,458 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   generator.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 9:30 PM
+ */
+
+#ifndef STATICLIB_RANGES_GENERATOR_HPP
+#define STATICLIB_RANGES_GENERATOR_HPP
+
+// generator is available only with compilers supporting C++20 coroutines
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define STATICLIB_RANGES_COROUTINES
+#endif
+#endif
+
+#ifdef STATICLIB_RANGES_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_generator {
+
+/**
+ * Thread-local cache of coroutine frames, freed frames are kept
+ * (up to the fixed number) and reused by the subsequent generators
+ * with the same (rounded) frame size. First frame allocation
+ * on each thread goes to the global `operator new`.
+ * Each frame is prefixed with a pointer to the pool of the thread, that
+ * allocated it. Frames freed on other threads, or after the pool of the current
+ * thread is destroyed (e.g. by generators held in static or other `thread_local`
+ * objects), are returned to the global `operator delete`.
+ */
+class frame_pool {
+    struct node {
+        node* next;
+        std::size_t size;
+    };
+
+    static const std::size_t granularity = 64;
+    static const std::size_t max_cached = 16;
+    // keeps the frame itself aligned as if allocated with global `operator new`
+    static const std::size_t header_size = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    node* head = nullptr;
+    std::size_t cached = 0;
+
+public:
+    frame_pool() { }
+
+    frame_pool(const frame_pool&) = delete;
+
+    frame_pool& operator=(const frame_pool&) = delete;
+
+    ~frame_pool() {
+        destroyed() = true;
+        while (nullptr != head) {
+            node* nd = head;
+            head = nd->next;
+            ::operator delete(static_cast<void*>(nd));
+        }
+    }
+
+    /**
+     * Pool of the current thread
+     *
+     * @return pool of the current thread, `nullptr` if it is already destroyed
+     */
+    static frame_pool* local() {
+        if (destroyed()) {
+            return nullptr;
+        }
+        static thread_local frame_pool pool;
+        return std::addressof(pool);
+    }
+
+    static void* allocate(std::size_t size) {
+        frame_pool* pool = local();
+        std::size_t rounded = round_size(size);
+        void* raw = nullptr != pool ? pool->take(rounded) : ::operator new(rounded);
+        *static_cast<frame_pool**>(raw) = pool;
+        return static_cast<char*>(raw) + header_size;
+    }
+
+    static void deallocate(void* ptr, std::size_t size) {
+        void* raw = static_cast<char*>(ptr) - header_size;
+        frame_pool* owner = *static_cast<frame_pool**>(raw);
+        if (nullptr != owner && owner == local()) {
+            owner->put(raw, round_size(size));
+        } else {
+            ::operator delete(raw);
+        }
+    }
+
+private:
+    // trivially destructible, so stays accessible during and after
+    // the destruction of thread-local objects
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    void* take(std::size_t rounded) {
+        node* prev = nullptr;
+        for (node* nd = head; nullptr != nd; nd = nd->next) {
+            if (rounded == nd->size) {
+                if (nullptr != prev) {
+                    prev->next = nd->next;
+                } else {
+                    head = nd->next;
+                }
+                cached -= 1;
+                return static_cast<void*>(nd);
+            }
+            prev = nd;
+        }
+        return ::operator new(rounded);
+    }
+
+    void put(void* raw, std::size_t rounded) {
+        if (cached < max_cached) {
+            node* nd = static_cast<node*>(raw);
+            nd->next = head;
+            nd->size = rounded;
+            head = nd;
+            cached += 1;
+        } else {
+            ::operator delete(raw);
+        }
+    }
+
+    static std::size_t round_size(std::size_t size) {
+        std::size_t res = (size + header_size + granularity - 1) / granularity * granularity;
+        return res >= sizeof(node) ? res : sizeof(node);
+    }
+};
+
+/**
+ * Lazy `InputIterator` implementation for `generator`.
+ * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Resumes the coroutine on increment and moves out the yielded element
+ * on dereference.
+ */
+template<typename Promise>
+class generator_iter {
+    std::coroutine_handle<Promise> handle;
+
+public:
+    using value_type = typename Promise::value_type;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param handle coroutine handle, empty for "past the end" iterator
+     */
+    explicit generator_iter(std::coroutine_handle<Promise> handle) :
+    handle(handle) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    generator_iter(const generator_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    generator_iter& operator=(const generator_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    generator_iter(generator_iter&& other) :
+    handle(other.handle) {
+        other.handle = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    generator_iter& operator=(generator_iter&& other) {
+        this->handle = other.handle;
+        other.handle = nullptr;
+        return *this;
+    }
+
+    /**
+     * Resumes coroutine until the next element is yielded
+     *
+     * @return reference to iter instance
+     */
+    generator_iter& operator++() {
+        if (handle && !handle.done()) {
+            handle.promise().resume(handle);
+        }
+        return *this;
+    }
+
+    /**
+     * Resumes coroutine until the next element is yielded
+     *
+     * @return reference to iter instance
+     */
+    generator_iter& operator++(int) {
+        return ++*this;
+    }
+
+    /**
+     * Will move out the yielded element
+     *
+     * @return yielded element
+     */
+    value_type operator*() {
+        if (handle && !handle.done()) {
+            return handle.promise().take();
+        } else {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+    }
+
+    /**
+     * Compares this iterator instance with a "past the end"
+     * Does NOT support arbitrary input instances,
+     * should be used only to compare with "past the end" iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const generator_iter& end) const {
+        return (this->handle && !this->handle.done()) ||
+                (end.handle && !end.handle.done());
+    }
+};
+
+} // namespace
+
+/**
+ * Lazy `SinglePassRange` implemented as C++20 coroutine, elements are
+ * produced with `co_yield` expressions. Coroutine starts on the `begin()`
+ * call and is suspended on each yield until the iterator is incremented.
+ * Elements yielded as rvalues are moved out directly from the coroutine frame,
+ * lvalues are copied once into the promise. Exception thrown from the coroutine
+ * body is rethrown from `begin()` or from iterator increment.
+ * Coroutine frames are allocated from the thread-local pool of recycled frames,
+ * so after the warm-up on each thread creating generators does not touch
+ * the global heap. Generators can be destroyed on other threads, their frames
+ * are freed to the global heap in that case.
+ *
+ * Generators should be passed to other operations (`transform`, `filter`, `concat` etc)
+ * as rvalues.
+ */
+template<typename T>
+class generator {
+public:
+    static_assert(!std::is_reference<T>::value, "Reference elements are not supported");
+
+    class promise_type {
+        friend class detail_generator::generator_iter<promise_type>;
+
+        T* current = nullptr;
+        std::optional<T> copied;
+        std::exception_ptr error;
+
+    public:
+        using value_type = T;
+
+        static void* operator new(std::size_t size) {
+            return detail_generator::frame_pool::allocate(size);
+        }
+
+        static void operator delete(void* ptr, std::size_t size) {
+            detail_generator::frame_pool::deallocate(ptr, size);
+        }
+
+        generator get_return_object() {
+            return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() {
+            return std::suspend_always();
+        }
+
+        std::suspend_always final_suspend() noexcept {
+            return std::suspend_always();
+        }
+
+        std::suspend_always yield_value(T&& value) {
+            this->current = std::addressof(value);
+            return std::suspend_always();
+        }
+
+        std::suspend_always yield_value(const T& value) {
+            copied.emplace(value);
+            this->current = std::addressof(*copied);
+            return std::suspend_always();
+        }
+
+        void return_void() { }
+
+        void unhandled_exception() {
+            this->error = std::current_exception();
+        }
+
+        // prohibit co_await inside generators
+        template<typename Other>
+        std::suspend_never await_transform(Other&&) = delete;
+
+    private:
+        void resume(std::coroutine_handle<promise_type> handle) {
+            this->current = nullptr;
+            handle.resume();
+            if (error) {
+                std::exception_ptr err = error;
+                this->error = nullptr;
+                std::rethrow_exception(err);
+            }
+        }
+
+        T take() {
+            return std::move(*current);
+        }
+    };
+
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = T;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_generator::generator_iter<promise_type>;
+
+private:
+    std::coroutine_handle<promise_type> handle;
+    bool started = false;
+
+    explicit generator(std::coroutine_handle<promise_type> handle) :
+    handle(handle) { }
+
+public:
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    generator(const generator& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    generator& operator=(const generator& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    generator(generator&& other) :
+    handle(other.handle),
+    started(other.started) {
+        other.handle = nullptr;
+    }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    generator& operator=(generator&& other) = delete;
+
+    /**
+     * Destructor, destroys coroutine frame
+     */
+    ~generator() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    /**
+     * Returns `begin` iterator, runs coroutine until the first yield
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        if (!handle || started) {
+            throw std::range_error("Invalid attempt to get a 'begin()' iterator the second time");
+        }
+        this->started = true;
+        auto it = iterator(handle);
+        ++it;
+        return it;
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+};
+
+} // namespace
+}
+
+#endif // STATICLIB_RANGES_COROUTINES
+
+#endif /* STATICLIB_RANGES_GENERATOR_HPP */
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   group_aggregate.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 9:40 AM
+ */
+
+#ifndef STATICLIB_RANGES_GROUP_AGGREGATE_HPP
+#define STATICLIB_RANGES_GROUP_AGGREGATE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/ranges/flat_hash.hpp"
+#include "staticlib/ranges/fusion.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_group_aggregate {
+
+template<typename Range, typename KeyFn>
+using key_type = typename std::decay<decltype(std::declval<KeyFn&>()(std::declval<
+        typename std::iterator_traits<decltype(std::declval<Range&>().begin())>::value_type&>()))>::type;
+
+/**
+ * Sink for `group_aggregate` operation, finds (or inserts) the accumulator
+ * for the element key and updates it with the element
+ */
+template<typename Map, typename KeyFn, typename T, typename AggFn>
+class aggregate_sink {
+    Map* map;
+    KeyFn* key_fn;
+    const T* init;
+    AggFn* agg_fn;
+
+public:
+    aggregate_sink(Map& map, KeyFn& key_fn, const T& init, AggFn& agg_fn) :
+    map(std::addressof(map)),
+    key_fn(std::addressof(key_fn)),
+    init(std::addressof(init)),
+    agg_fn(std::addressof(agg_fn)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        auto& acc = map->emplace((*key_fn)(ref), *init).first->second;
+        acc = (*agg_fn)(std::move(acc), std::move(el));
+        return true;
+    }
+};
+
+} // namespace
+
+/**
+ * Hash-based "group by" terminal operation: consumes all the elements of the specified
+ * range and folds the elements with equal keys into separate accumulators, accumulator
+ * for each new key starts as a copy of `init` and is updated as
+ * `acc = agg_fn(std::move(acc), std::move(el))`. Accumulators are stored inline
+ * in the open-addressing `flat_hash_map`, no memory is allocated per key.
+ * Chains of wrappers from this library are evaluated in a single fused loop,
+ * move-only elements are supported.
+ *
+ * @param range input range
+ * @param key_fn `FunctionObject` with signature `Key(Elem&)`
+ * @param init initial accumulator value for each key
+ * @param agg_fn `FunctionObject` with signature `T(T&&, Elem&&)`
+ * @param cardinality_hint expected number of distinct keys, table is pre-sized
+ *        for this number of keys, `0` (default) to grow on demand
+ * @return map of keys to accumulated values
+ * @throws std::length_error if the table for `cardinality_hint` keys cannot be addressed
+ */
+template<typename Range, typename KeyFn, typename T, typename AggFn>
+flat_hash_map<detail_group_aggregate::key_type<Range, KeyFn>, T> group_aggregate(Range& range,
+        KeyFn key_fn, T init, AggFn agg_fn, std::size_t cardinality_hint = 0) {
+    using map_type = flat_hash_map<detail_group_aggregate::key_type<Range, KeyFn>, T>;
+    map_type map(cardinality_hint);
+    detail_group_aggregate::aggregate_sink<map_type, KeyFn, T, AggFn> sink(map, key_fn, init, agg_fn);
+    fused_for_each(range, sink);
+    return map;
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_GROUP_AGGREGATE_HPP */
@@ -0,0 +1,502 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   join.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 3:00 PM
+ */
+
+#ifndef STATICLIB_RANGES_JOIN_HPP
+#define STATICLIB_RANGES_JOIN_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/flat_hash.hpp"
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_join {
+
+template<typename Range>
+using elem_type = typename std::iterator_traits<decltype(std::declval<Range&>().begin())>::value_type;
+
+template<typename Range, typename KeyFn>
+using key_type = typename std::decay<decltype(std::declval<KeyFn&>()(std::declval<elem_type<Range>&>()))>::type;
+
+/**
+ * Materialized build side of the hash join: rows are stored in a vector in the source order,
+ * hash map points to the first row with each key, rows with equal keys are chained
+ * through the array of the next row indices
+ */
+template<typename Row, typename Key>
+class build_table {
+    std::vector<Row> rows;
+    std::vector<std::size_t> next_rows;
+    flat_hash_map<Key, std::size_t> heads;
+
+public:
+    /**
+     * Index that marks the end of the chain
+     */
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    template<typename Range, typename KeyFn>
+    build_table(Range& range, KeyFn& key_fn) :
+    rows(detail_fusion::collect(range, std::vector<Row>())) {
+        next_rows.resize(rows.size(), npos);
+        heads.reserve(rows.size());
+        // backwards, so chains are in the source order
+        for (std::size_t i = rows.size(); i > 0; i--) {
+            std::size_t idx = i - 1;
+            auto res = heads.emplace(key_fn(rows[idx]), idx);
+            if (!res.second) {
+                next_rows[idx] = res.first->second;
+                res.first->second = idx;
+            }
+        }
+    }
+
+    build_table(build_table&& other) :
+    rows(std::move(other.rows)),
+    next_rows(std::move(other.next_rows)),
+    heads(std::move(other.heads)) { }
+
+    std::size_t first(const Key& key) const {
+        auto it = heads.find(key);
+        return heads.end() != it ? it->second : npos;
+    }
+
+    std::size_t next(std::size_t idx) const {
+        return next_rows[idx];
+    }
+
+    Row& row(std::size_t idx) {
+        return rows[idx];
+    }
+};
+
+template<typename Row, typename Key>
+const std::size_t build_table<Row, Key>::npos;
+
+/**
+ * Sink for `hash_join` operation, pushes combined results
+ * for all the build rows matching the probe element to the next sink
+ */
+template<typename Table, typename KeyFn, typename Combine, typename Sink>
+class join_sink {
+    Table* table;
+    KeyFn* key_fn;
+    Combine* combine;
+    Sink* next;
+
+public:
+    join_sink(Table& table, KeyFn& key_fn, Combine& combine, Sink& next) :
+    table(std::addressof(table)),
+    key_fn(std::addressof(key_fn)),
+    combine(std::addressof(combine)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        for (std::size_t idx = table->first((*key_fn)(ref)); Table::npos != idx; idx = table->next(idx)) {
+            if (!(*next)((*combine)(table->row(idx), ref))) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * Sink that collects the keys of all the elements into the set
+ */
+template<typename Set, typename KeyFn>
+class key_sink {
+    Set* keys;
+    KeyFn* key_fn;
+
+public:
+    key_sink(Set& keys, KeyFn& key_fn) :
+    keys(std::addressof(keys)),
+    key_fn(std::addressof(key_fn)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        keys->insert((*key_fn)(ref));
+        return true;
+    }
+};
+
+/**
+ * Filtering predicate for `semi_join` and `anti_join` operations,
+ * checks whether the key of the element is present in the build side,
+ * does not modify its state and can be used from multiple threads
+ */
+template<typename Key, typename KeyFn, bool Matched>
+class key_filter {
+    flat_hash_set<Key> keys;
+    KeyFn key_fn;
+
+public:
+    template<typename Range, typename BuildKeyFn>
+    key_filter(Range& build_range, BuildKeyFn& build_key, KeyFn key_fn) :
+    key_fn(std::move(key_fn)) {
+        auto sink = key_sink<flat_hash_set<Key>, BuildKeyFn>(keys, build_key);
+        staticlib::ranges::fused_for_each(build_range, sink);
+    }
+
+    key_filter(key_filter&& other) :
+    keys(std::move(other.keys)),
+    key_fn(std::move(other.key_fn)) { }
+
+    template<typename Elem>
+    bool operator()(Elem& el) {
+        return Matched == keys.contains(key_fn(el));
+    }
+};
+
+template<typename Probe, typename Build, typename BuildKeyFn, typename ProbeKeyFn, bool Matched>
+using key_filter_for = key_filter<key_type<typename detail_refwrap::adapted<Build>::type, BuildKeyFn>,
+        ProbeKeyFn, Matched>;
+
+template<typename Probe>
+using offcaster_for = detail_filter::offcaster<elem_type<typename detail_refwrap::adapted<Probe>::type>>;
+
+template<bool Matched, typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn, typename Dest>
+filtered_range<typename detail_refwrap::adapted<Probe>::type,
+        key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, Matched>, Dest>
+key_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key,
+        Dest offcast_dest) {
+    using pred_type = key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, Matched>;
+    auto build = detail_refwrap::adapted<Build>::adapt(std::forward<Build>(build_range));
+    auto pred = pred_type(build, build_key, std::move(probe_key));
+    return filter(detail_refwrap::adapted<Probe>::adapt(std::forward<Probe>(probe_range)),
+            std::move(pred), std::move(offcast_dest));
+}
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for `hash_join` (inner join) operation.
+ * Build side is materialized on construction, probe range is streamed lazily,
+ * for each probe element results are returned for all the matching build rows
+ * in the order of the build range. Results are moved out in the same way as
+ * results of `transform`.
+ */
+template<typename Range, typename Table, typename KeyFn, typename Combine>
+class joined_range : public range_adapter<joined_range<Range, Table, KeyFn, Combine>,
+        typename std::decay<decltype(std::declval<Combine&>()(std::declval<Table&>().row(0),
+                std::declval<detail_join::elem_type<Range>&>()))>::type> {
+    using probe_type = detail_join::elem_type<Range>;
+    using result_type = typename std::decay<decltype(std::declval<Combine&>()(
+            std::declval<Table&>().row(0), std::declval<probe_type&>()))>::type;
+    using iterator = decltype(std::declval<Range&>().begin());
+
+    // heap-allocated, keeps current probe element between increments
+    class cursor {
+        typename std::aligned_storage<sizeof(probe_type), std::alignment_of<probe_type>::value>::type slot;
+        bool loaded = false;
+
+    public:
+        iterator it;
+        iterator end;
+        std::size_t row = Table::npos;
+
+        cursor(iterator&& it, iterator&& end) :
+        it(std::move(it)),
+        end(std::move(end)) { }
+
+        ~cursor() {
+            drop();
+        }
+
+        probe_type& probe() {
+            return *reinterpret_cast<probe_type*>(std::addressof(slot));
+        }
+
+        void load() {
+            new (std::addressof(slot)) probe_type(std::move(*it));
+            this->loaded = true;
+        }
+
+        // source is advanced lazily, so the loaded probe element (that may
+        // point into the source, e.g. `record_view`) stays valid until the next load
+        void advance() {
+            if (loaded) {
+                drop();
+                ++it;
+            }
+        }
+
+        void drop() {
+            if (loaded) {
+                probe().~probe_type();
+                this->loaded = false;
+            }
+        }
+    };
+
+    Range probe_range;
+    Table table;
+    KeyFn probe_key;
+    Combine combine;
+    std::unique_ptr<cursor> cur;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range and table
+     *
+     * @param probe_range probe range
+     * @param table materialized build side
+     * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+     * @param combine `FunctionObject` with signature `Result(BuildElem&, ProbeElem&)`
+     */
+    joined_range(Range&& probe_range, Table&& table, KeyFn probe_key, Combine combine) :
+    probe_range(std::move(probe_range)),
+    table(std::move(table)),
+    probe_key(std::move(probe_key)),
+    combine(std::move(combine)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    joined_range(const joined_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    joined_range& operator=(const joined_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    joined_range(joined_range&& other) :
+    range_adapter<joined_range<Range, Table, KeyFn, Combine>, result_type>(std::move(other)),
+    probe_range(std::move(other.probe_range)),
+    table(std::move(other.table)),
+    probe_key(std::move(other.probe_key)),
+    combine(std::move(other.combine)),
+    cur(std::move(other.cur)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    joined_range& operator=(joined_range&& other) = delete;
+
+    /**
+     * Computes result for the next matching build row, advances probe range if necessary
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        std::size_t idx = next_row();
+        if (Table::npos != idx) {
+            return this->set_current(combine(table.row(idx), cur->probe()));
+        }
+        return false;
+    }
+
+    /**
+     * Pushes results for all the remaining probe elements
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        if (!cur) {
+            auto stage = detail_join::join_sink<Table, KeyFn, Combine, Sink>(table, probe_key, combine, sink);
+            return staticlib::ranges::fused_for_each(probe_range, stage);
+        }
+        // iteration was already started, continue from the current probe element
+        for (;;) {
+            std::size_t idx = next_row();
+            if (Table::npos == idx) {
+                return true;
+            }
+            if (!sink(combine(table.row(idx), cur->probe()))) {
+                return false;
+            }
+        }
+    }
+
+private:
+    std::size_t next_row() {
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new cursor(std::move(probe_range.begin()), std::move(probe_range.end())));
+        }
+        while (Table::npos == cur->row) {
+            cur->advance();
+            if (!(cur->it != cur->end)) {
+                return Table::npos;
+            }
+            cur->load();
+            cur->row = table.first(probe_key(cur->probe()));
+        }
+        std::size_t idx = cur->row;
+        cur->row = table.next(idx);
+        return idx;
+    }
+};
+
+/**
+ * Hash join (inner join) of two ranges: all the elements of the build range are
+ * moved into a compact hash table (single vector of rows, open-addressing `flat_hash_map`
+ * of keys to row indices and a vector of next row indices for rows with equal keys)
+ * eagerly, then probe range is streamed lazily, see `joined_range`.
+ * Smaller range should be used as a build range.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param build_range build range, materialized eagerly
+ * @param probe_range probe range, streamed lazily
+ * @param build_key `FunctionObject` with signature `Key(BuildElem&)`
+ * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+ * @param combine `FunctionObject` with signature `Result(BuildElem&, ProbeElem&)`
+ * @return joined range
+ */
+template<typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn, typename Combine>
+joined_range<typename detail_refwrap::adapted<Probe>::type,
+        detail_join::build_table<detail_join::elem_type<typename detail_refwrap::adapted<Build>::type>,
+                detail_join::key_type<typename detail_refwrap::adapted<Build>::type, BuildKeyFn>>,
+        ProbeKeyFn, Combine>
+hash_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key,
+        Combine combine) {
+    using build_type = typename detail_refwrap::adapted<Build>::type;
+    using table_type = detail_join::build_table<detail_join::elem_type<build_type>,
+            detail_join::key_type<build_type, BuildKeyFn>>;
+    auto build = detail_refwrap::adapted<Build>::adapt(std::forward<Build>(build_range));
+    auto table = table_type(build, build_key);
+    return joined_range<typename detail_refwrap::adapted<Probe>::type, table_type, ProbeKeyFn, Combine>(
+            detail_refwrap::adapted<Probe>::adapt(std::forward<Probe>(probe_range)),
+            std::move(table), std::move(probe_key), std::move(combine));
+}
+
+/**
+ * Lazily filters probe range keeping only the elements, that have matching elements
+ * (with equal keys) in the build range. Keys of the build range are collected into
+ * `flat_hash_set` eagerly. Probe elements without matches are applied to
+ * the specified `FunctionObject` in the same way as `filter` offcasts.
+ *
+ * @param build_range build range, consumed eagerly
+ * @param probe_range probe range, streamed lazily
+ * @param build_key `FunctionObject` with signature `Key(BuildElem&)`
+ * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+ * @param offcast_dest `FunctionObject` to apply unmatched probe elements to it
+ * @return filtered range
+ */
+template<typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn, typename Dest>
+filtered_range<typename detail_refwrap::adapted<Probe>::type,
+        detail_join::key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, true>, Dest>
+semi_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key,
+        Dest offcast_dest) {
+    return detail_join::key_join<true>(std::forward<Build>(build_range), std::forward<Probe>(probe_range),
+            std::move(build_key), std::move(probe_key), std::move(offcast_dest));
+}
+
+/**
+ * Lazily filters probe range keeping only the elements, that have matching elements
+ * in the build range, unmatched elements are discarded, see `semi_join` above.
+ *
+ * @param build_range build range, consumed eagerly
+ * @param probe_range probe range, streamed lazily
+ * @param build_key `FunctionObject` with signature `Key(BuildElem&)`
+ * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+ * @return filtered range
+ */
+template<typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn>
+filtered_range<typename detail_refwrap::adapted<Probe>::type,
+        detail_join::key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, true>,
+        detail_join::offcaster_for<Probe>>
+semi_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key) {
+    return detail_join::key_join<true>(std::forward<Build>(build_range), std::forward<Probe>(probe_range),
+            std::move(build_key), std::move(probe_key), detail_join::offcaster_for<Probe>());
+}
+
+/**
+ * Lazily filters probe range keeping only the elements, that have NO matching elements
+ * (with equal keys) in the build range. Keys of the build range are collected into
+ * `flat_hash_set` eagerly. Matched probe elements are applied to the specified
+ * `FunctionObject` in the same way as `filter` offcasts.
+ *
+ * @param build_range build range, consumed eagerly
+ * @param probe_range probe range, streamed lazily
+ * @param build_key `FunctionObject` with signature `Key(BuildElem&)`
+ * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+ * @param offcast_dest `FunctionObject` to apply matched probe elements to it
+ * @return filtered range
+ */
+template<typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn, typename Dest>
+filtered_range<typename detail_refwrap::adapted<Probe>::type,
+        detail_join::key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, false>, Dest>
+anti_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key,
+        Dest offcast_dest) {
+    return detail_join::key_join<false>(std::forward<Build>(build_range), std::forward<Probe>(probe_range),
+            std::move(build_key), std::move(probe_key), std::move(offcast_dest));
+}
+
+/**
+ * Lazily filters probe range keeping only the elements, that have NO matching elements
+ * in the build range, matched elements are discarded, see `anti_join` above.
+ *
+ * @param build_range build range, consumed eagerly
+ * @param probe_range probe range, streamed lazily
+ * @param build_key `FunctionObject` with signature `Key(BuildElem&)`
+ * @param probe_key `FunctionObject` with signature `Key(ProbeElem&)`
+ * @return filtered range
+ */
+template<typename Build, typename Probe, typename BuildKeyFn, typename ProbeKeyFn>
+filtered_range<typename detail_refwrap::adapted<Probe>::type,
+        detail_join::key_filter_for<Probe, Build, BuildKeyFn, ProbeKeyFn, false>,
+        detail_join::offcaster_for<Probe>>
+anti_join(Build&& build_range, Probe&& probe_range, BuildKeyFn build_key, ProbeKeyFn probe_key) {
+    return detail_join::key_join<false>(std::forward<Build>(build_range), std::forward<Probe>(probe_range),
+            std::move(build_key), std::move(probe_key), detail_join::offcaster_for<Probe>());
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_JOIN_HPP */
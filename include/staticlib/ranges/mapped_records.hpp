@@ -0,0 +1,282 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   mapped_records.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 11:10 PM
+ */
+
+#ifndef STATICLIB_RANGES_MAPPED_RECORDS_HPP
+#define STATICLIB_RANGES_MAPPED_RECORDS_HPP
+
+// memory-mapped sources are available only on POSIX platforms
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/record_view.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Zero-copy source range, that maps the specified file into memory
+ * and yields delimiter-separated records (lines by default) as `record_view`
+ * slices of the mapping, no memory is allocated and no bytes are copied per record.
+ * Delimiters are not included into records, last record is returned
+ * even if it does not end with delimiter.
+ *
+ * By default the whole file is mapped at once and returned views remain valid
+ * while this range is alive. For files larger than available RAM (or address space)
+ * sliding window size can be specified - only the window-sized part of the file is mapped
+ * at a time and returned views remain valid only until the next increment.
+ * Window is enlarged automatically when it is too small for a single record.
+ * Mappings are created with `MADV_SEQUENTIAL` advice.
+ */
+class mapped_records : public range_adapter<mapped_records, record_view> {
+    std::string path;
+    char delimiter;
+    std::size_t window;
+    int fd = -1;
+    std::size_t file_size = 0;
+    char* map_ptr = nullptr;
+    std::size_t map_offset = 0;
+    std::size_t map_len = 0;
+    std::size_t pos = 0;
+
+public:
+    /**
+     * Constructor, opens and maps specified file
+     *
+     * @param path path to file
+     * @param delimiter records delimiter
+     * @param window_size sliding window size in bytes, `0` (default) to map the whole file
+     * @throws std::runtime_error on file open or mapping error
+     */
+    mapped_records(const std::string& path, char delimiter = '\n', std::size_t window_size = 0) :
+    path(path),
+    delimiter(delimiter),
+    window(0) {
+        this->fd = ::open(path.c_str(), O_RDONLY);
+        if (-1 == fd) {
+            throw_error("Error opening file");
+        }
+        struct stat st;
+        if (-1 == ::fstat(fd, std::addressof(st))) {
+            int err = errno;
+            close_fd();
+            errno = err;
+            throw_error("Error reading file size");
+        }
+        this->file_size = static_cast<std::size_t>(st.st_size);
+        if (window_size > 0) {
+            // at least two pages, so a record starting in the first page always gets some space
+            std::size_t page = page_size();
+            std::size_t rounded = (window_size + page - 1) / page * page;
+            this->window = rounded >= 2 * page ? rounded : 2 * page;
+        } else {
+            try {
+                if (file_size > 0) {
+                    map(0, file_size);
+                }
+            } catch (...) {
+                close_fd();
+                throw;
+            }
+            close_fd();
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    mapped_records(const mapped_records& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    mapped_records& operator=(const mapped_records& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    mapped_records(mapped_records&& other) :
+    range_adapter<mapped_records, record_view>(std::move(other)),
+    path(std::move(other.path)),
+    delimiter(other.delimiter),
+    window(other.window),
+    fd(other.fd),
+    file_size(other.file_size),
+    map_ptr(other.map_ptr),
+    map_offset(other.map_offset),
+    map_len(other.map_len),
+    pos(other.pos) {
+        other.fd = -1;
+        other.map_ptr = nullptr;
+        other.file_size = 0;
+    }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    mapped_records& operator=(mapped_records&& other) = delete;
+
+    /**
+     * Destructor, unmaps the file
+     */
+    ~mapped_records() {
+        unmap();
+        close_fd();
+    }
+
+    /**
+     * Finds the next record in the mapped file
+     *
+     * @return true if next record exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        record_view rec;
+        if (next_record(rec)) {
+            return set_current(std::move(rec));
+        }
+        return false;
+    }
+
+    /**
+     * Pushes all the remaining records into the specified sink,
+     * see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push records into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        record_view rec;
+        while (next_record(rec)) {
+            if (!sink(std::move(rec))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    bool next_record(record_view& rec) {
+        if (pos >= file_size) {
+            return false;
+        }
+        for (;;) {
+            if (nullptr == map_ptr || pos < map_offset || pos >= map_offset + map_len) {
+                remap(pos);
+            }
+            const char* start = map_ptr + (pos - map_offset);
+            std::size_t avail = map_offset + map_len - pos;
+            const void* found = std::memchr(start, delimiter, avail);
+            if (nullptr != found) {
+                std::size_t len = static_cast<std::size_t>(static_cast<const char*>(found) - start);
+                rec = record_view(start, len);
+                this->pos += len + 1;
+                return true;
+            }
+            if (map_offset + map_len >= file_size) {
+                rec = record_view(start, avail);
+                this->pos = file_size;
+                return true;
+            }
+            // record crosses the window end, move window to the record start,
+            // enlarge it if record does not fit into the window
+            if (page_floor(pos) == map_offset) {
+                this->window *= 2;
+            }
+            remap(pos);
+        }
+    }
+
+    void remap(std::size_t offset) {
+        unmap();
+        std::size_t start = page_floor(offset);
+        std::size_t rest = file_size - start;
+        map(start, window < rest ? window : rest);
+    }
+
+    void map(std::size_t offset, std::size_t len) {
+        void* ptr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+        if (MAP_FAILED == ptr) {
+            throw_error("Error mapping file");
+        }
+        ::madvise(ptr, len, MADV_SEQUENTIAL);
+        this->map_ptr = static_cast<char*>(ptr);
+        this->map_offset = offset;
+        this->map_len = len;
+    }
+
+    void unmap() {
+        if (nullptr != map_ptr) {
+            ::munmap(map_ptr, map_len);
+            this->map_ptr = nullptr;
+        }
+    }
+
+    void close_fd() {
+        if (-1 != fd) {
+            ::close(fd);
+            this->fd = -1;
+        }
+    }
+
+    std::size_t page_floor(std::size_t offset) const {
+        return offset / page_size() * page_size();
+    }
+
+    static std::size_t page_size() {
+        static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    void throw_error(const std::string& msg) const {
+        throw std::runtime_error(msg + ", path: [" + path + "], error: [" + std::strerror(errno) + "]");
+    }
+};
+
+} // namespace
+}
+
+#endif // POSIX
+
+#endif /* STATICLIB_RANGES_MAPPED_RECORDS_HPP */
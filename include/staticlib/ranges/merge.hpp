@@ -0,0 +1,524 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   merge.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 11:00 AM
+ */
+
+#ifndef STATICLIB_RANGES_MERGE_HPP
+#define STATICLIB_RANGES_MERGE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_merge {
+
+/**
+ * Current (not yet merged) elements of all the sources of the merge,
+ * stored contiguously and indexed by the source index
+ */
+template<typename Elem>
+class slots {
+    struct slot {
+        typename std::aligned_storage<sizeof(Elem), std::alignment_of<Elem>::value>::type value;
+        bool loaded;
+    };
+
+    std::unique_ptr<slot[]> data;
+    std::size_t count;
+
+public:
+    slots(std::size_t count) :
+    data(new slot[count]()),
+    count(count) { }
+
+    slots(const slots&) = delete;
+
+    slots& operator=(const slots&) = delete;
+
+    slots(slots&& other) :
+    data(std::move(other.data)),
+    count(other.count) {
+        other.count = 0;
+    }
+
+    slots& operator=(slots&&) = delete;
+
+    ~slots() {
+        for (std::size_t i = 0; i < count; i++) {
+            drop(i);
+        }
+    }
+
+    bool loaded(std::size_t idx) const {
+        return data[idx].loaded;
+    }
+
+    Elem& get(std::size_t idx) {
+        return *reinterpret_cast<Elem*>(std::addressof(data[idx].value));
+    }
+
+    template<typename Other>
+    void put(std::size_t idx, Other&& el) {
+        drop(idx);
+        new (std::addressof(data[idx].value)) Elem(std::forward<Other>(el));
+        data[idx].loaded = true;
+    }
+
+    void drop(std::size_t idx) {
+        if (data[idx].loaded) {
+            get(idx).~Elem();
+            data[idx].loaded = false;
+        }
+    }
+};
+
+/**
+ * Sorted source over the specified range, source range iteration
+ * is started on the first fetch
+ */
+template<typename Range>
+class range_cursor {
+    using iterator = decltype(std::declval<Range&>().begin());
+
+    struct cursor {
+        iterator it;
+        iterator end;
+    };
+
+    Range range;
+    std::unique_ptr<cursor> cur;
+
+public:
+    range_cursor(Range&& range) :
+    range(std::move(range)) { }
+
+    range_cursor(const range_cursor&) = delete;
+
+    range_cursor& operator=(const range_cursor&) = delete;
+
+    range_cursor(range_cursor&& other) :
+    range(std::move(other.range)),
+    cur(std::move(other.cur)) { }
+
+    range_cursor& operator=(range_cursor&&) = delete;
+
+    /**
+     * Replaces the current element in the specified slot
+     * with the next element of the source
+     *
+     * @param dest slots of the merge
+     * @param idx index of this source
+     * @return false if source is exhausted, true otherwise
+     */
+    template<typename Elem>
+    bool fetch(slots<Elem>& dest, std::size_t idx) {
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new cursor{std::move(range.begin()), std::move(range.end())});
+        } else if (cur->it != cur->end) {
+            ++cur->it;
+        }
+        if (cur->it != cur->end) {
+            dest.put(idx, std::move(*cur->it));
+            return true;
+        }
+        dest.drop(idx);
+        return false;
+    }
+
+    /**
+     * Size hint of the source, valid only before the first fetch
+     *
+     * @return size hint
+     */
+    size_hint hint() const {
+        return staticlib::ranges::get_size_hint(range);
+    }
+};
+
+template<typename Tuple, std::size_t I, std::size_t N>
+struct tuple_hint {
+    static size_hint get(const Tuple& cursors) {
+        return std::get<I>(cursors).hint().plus(tuple_hint<Tuple, I + 1, N>::get(cursors));
+    }
+};
+
+template<typename Tuple, std::size_t N>
+struct tuple_hint<Tuple, N, N> {
+    static size_hint get(const Tuple&) {
+        return size_hint::exact(0);
+    }
+};
+
+/**
+ * Compile-time list of sources of different types, fetch from the source
+ * is dispatched by its index at runtime through static table of function pointers
+ */
+template<typename... Ranges>
+class tuple_sources {
+    using tuple_type = std::tuple<range_cursor<Ranges>...>;
+
+    tuple_type cursors;
+
+public:
+    tuple_sources(Ranges&&... ranges) :
+    cursors(range_cursor<Ranges>(std::move(ranges))...) { }
+
+    tuple_sources(const tuple_sources&) = delete;
+
+    tuple_sources& operator=(const tuple_sources&) = delete;
+
+    tuple_sources(tuple_sources&& other) :
+    cursors(std::move(other.cursors)) { }
+
+    tuple_sources& operator=(tuple_sources&&) = delete;
+
+    std::size_t size() const {
+        return sizeof...(Ranges);
+    }
+
+    template<typename Elem>
+    bool fetch(slots<Elem>& dest, std::size_t idx) {
+        return fetch(dest, idx, make_index_sequence<sizeof...(Ranges)>());
+    }
+
+    size_hint hint() const {
+        return tuple_hint<tuple_type, 0, sizeof...(Ranges)>::get(cursors);
+    }
+
+private:
+    template<typename Elem, std::size_t I>
+    static bool fetch_at(tuple_type& cursors, slots<Elem>& dest, std::size_t idx) {
+        return std::get<I>(cursors).fetch(dest, idx);
+    }
+
+    template<typename Elem, std::size_t... Indices>
+    bool fetch(slots<Elem>& dest, std::size_t idx, index_sequence<Indices...>) {
+        using fun_type = bool(*)(tuple_type&, slots<Elem>&, std::size_t);
+        static const fun_type table[] = {&tuple_sources::fetch_at<Elem, Indices>...};
+        return table[idx](cursors, dest, idx);
+    }
+};
+
+/**
+ * Runtime-specified list of sources of the same type
+ */
+template<typename Range>
+class vector_sources {
+    std::vector<range_cursor<Range>> cursors;
+
+public:
+    vector_sources(std::vector<Range>&& ranges) {
+        cursors.reserve(ranges.size());
+        for (auto& ra : ranges) {
+            cursors.emplace_back(std::move(ra));
+        }
+    }
+
+    vector_sources(const vector_sources&) = delete;
+
+    vector_sources& operator=(const vector_sources&) = delete;
+
+    vector_sources(vector_sources&& other) :
+    cursors(std::move(other.cursors)) { }
+
+    vector_sources& operator=(vector_sources&&) = delete;
+
+    std::size_t size() const {
+        return cursors.size();
+    }
+
+    template<typename Elem>
+    bool fetch(slots<Elem>& dest, std::size_t idx) {
+        return cursors[idx].fetch(dest, idx);
+    }
+
+    size_hint hint() const {
+        auto res = size_hint::exact(0);
+        for (auto& cur : cursors) {
+            res = res.plus(cur.hint());
+        }
+        return res;
+    }
+};
+
+template<typename Range, typename... Ranges>
+struct first_of {
+    using type = Range;
+};
+
+template<typename Range>
+using elem_type = typename std::iterator_traits<decltype(std::declval<Range&>().begin())>::value_type;
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for the k-way `merge` operation over
+ * the ranges sorted with the specified comparator. Current elements of the source ranges
+ * are kept contiguously and are ordered in a tournament tree of losers (loser tree),
+ * so each result element costs `O(log(k))` comparisons along a single leaf-to-root path,
+ * only the source, that provided the previous result element, is advanced on increment.
+ * Sources are not type-erased, `merge` keeps them in a `std::tuple`, `merge_all`
+ * keeps them in a `std::vector`.
+ * Elements equal according to comparator are returned in the order of source ranges
+ * (merge is stable). Elements are moved from source ranges, result element type is
+ * the element type of the first source range, elements of other source ranges
+ * must be convertible to it.
+ */
+template<typename Elem, typename Comp, typename Sources>
+class merged_range : public range_adapter<merged_range<Elem, Comp, Sources>, Elem> {
+    Sources sources;
+    detail_merge::slots<Elem> slots;
+    Comp comparator;
+    // tree[0] is the winner index, tree[1..k-1] are the loser indices
+    std::vector<std::size_t> tree;
+    bool started = false;
+    // source, that provided the last returned element
+    std::size_t last;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified sources
+     *
+     * @param sources sorted sources
+     * @param comparator `Compare` function object
+     */
+    merged_range(Sources&& sources, Comp comparator) :
+    sources(std::move(sources)),
+    slots(this->sources.size()),
+    comparator(std::move(comparator)),
+    last(this->sources.size()) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    merged_range(const merged_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    merged_range& operator=(const merged_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    merged_range(merged_range&& other) :
+    range_adapter<merged_range<Elem, Comp, Sources>, Elem>(std::move(other)),
+    sources(std::move(other.sources)),
+    slots(std::move(other.slots)),
+    comparator(std::move(other.comparator)),
+    tree(std::move(other.tree)),
+    started(other.started),
+    last(other.last) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    merged_range& operator=(merged_range&& other) = delete;
+
+    /**
+     * Returns size hint of this range, combined from the size hints
+     * of all source ranges, unknown after the iteration is started
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        if (started) {
+            return size_hint::unknown();
+        }
+        return sources.hint();
+    }
+
+    /**
+     * Selects the smallest current element of the source ranges
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        std::size_t idx = next_winner();
+        if (idx < sources.size()) {
+            return this->set_current(std::move(slots.get(idx)));
+        }
+        return false;
+    }
+
+    /**
+     * Pushes all the remaining elements in merged order into
+     * the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        for (;;) {
+            std::size_t idx = next_winner();
+            if (idx >= sources.size()) {
+                return true;
+            }
+            if (!sink(std::move(slots.get(idx)))) {
+                return false;
+            }
+        }
+    }
+
+private:
+    // previous winner is advanced lazily, so the returned element (that may
+    // point into the source, e.g. `record_view`) stays valid until the next increment
+    std::size_t next_winner() {
+        std::size_t k = sources.size();
+        if (!started) {
+            build();
+        } else if (last < k) {
+            sources.fetch(slots, last);
+            replay(last);
+        }
+        std::size_t winner = tree.empty() ? k : tree[0];
+        if (winner < k && slots.loaded(winner)) {
+            this->last = winner;
+            return winner;
+        }
+        this->last = k;
+        return k;
+    }
+
+    void build() {
+        this->started = true;
+        std::size_t k = sources.size();
+        if (0 == k) {
+            return;
+        }
+        for (std::size_t i = 0; i < k; i++) {
+            sources.fetch(slots, i);
+        }
+        tree.resize(k);
+        auto winners = std::vector<std::size_t>(2 * k);
+        for (std::size_t i = 0; i < k; i++) {
+            winners[k + i] = i;
+        }
+        for (std::size_t node = k - 1; node > 0; node--) {
+            std::size_t left = winners[2 * node];
+            std::size_t right = winners[2 * node + 1];
+            if (beats(left, right)) {
+                winners[node] = left;
+                tree[node] = right;
+            } else {
+                winners[node] = right;
+                tree[node] = left;
+            }
+        }
+        tree[0] = k > 1 ? winners[1] : 0;
+    }
+
+    void replay(std::size_t idx) {
+        std::size_t winner = idx;
+        for (std::size_t node = (idx + sources.size()) / 2; node > 0; node /= 2) {
+            if (beats(tree[node], winner)) {
+                std::swap(tree[node], winner);
+            }
+        }
+        tree[0] = winner;
+    }
+
+    // single comparison per match, ties are won by the source with the lower index
+    bool beats(std::size_t a, std::size_t b) {
+        if (!slots.loaded(a)) {
+            return false;
+        }
+        if (!slots.loaded(b)) {
+            return true;
+        }
+        if (a < b) {
+            return !comparator(slots.get(b), slots.get(a));
+        }
+        return comparator(slots.get(a), slots.get(b));
+    }
+};
+
+/**
+ * Lazily merges input ranges, each sorted with the specified comparator, into single
+ * sorted output range, see `merged_range`.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ * Result element type is the element type of the first range, elements of other ranges
+ * must be convertible to it.
+ *
+ * @param comparator `Compare` function object, that was used to sort input ranges
+ * @param ranges sorted source ranges
+ * @return merged range
+ */
+template<typename Comp, typename... Ranges>
+merged_range<detail_merge::elem_type<typename detail_merge::first_of<
+        typename detail_refwrap::adapted<Ranges>::type...>::type>, Comp,
+        detail_merge::tuple_sources<typename detail_refwrap::adapted<Ranges>::type...>>
+merge(Comp comparator, Ranges&&... ranges) {
+    using elem = detail_merge::elem_type<typename detail_merge::first_of<
+            typename detail_refwrap::adapted<Ranges>::type...>::type>;
+    using sources_type = detail_merge::tuple_sources<typename detail_refwrap::adapted<Ranges>::type...>;
+    return merged_range<elem, Comp, sources_type>(
+            sources_type(detail_refwrap::adapted<Ranges>::adapt(std::forward<Ranges>(ranges))...),
+            std::move(comparator));
+}
+
+/**
+ * Lazily merges the runtime-specified number of sorted input ranges (e.g. sorted shards)
+ * into single sorted output range, see `merged_range`. Created range will own specified ranges.
+ *
+ * @param comparator `Compare` function object, that was used to sort input ranges
+ * @param ranges sorted source ranges
+ * @return merged range
+ */
+template<typename Comp, typename Range>
+merged_range<detail_merge::elem_type<Range>, Comp, detail_merge::vector_sources<Range>>
+merge_all(Comp comparator, std::vector<Range>&& ranges) {
+    using sources_type = detail_merge::vector_sources<Range>;
+    return merged_range<detail_merge::elem_type<Range>, Comp, sources_type>(
+            sources_type(std::move(ranges)), std::move(comparator));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_MERGE_HPP */
@@ -0,0 +1,267 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parallel.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 3:10 PM
+ */
+
+#ifndef STATICLIB_RANGES_PARALLEL_HPP
+#define STATICLIB_RANGES_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Execution policy for the parallel eager operations.
+ *
+ * Parallel operations are supported for the ranges, whose innermost source
+ * is a random-access range (e.g. `std::vector` taken by reference or by value),
+ * index space of the innermost source is split into contiguous chunks,
+ * that are processed on separate threads. All the functors, predicates and
+ * offcast destinations of the processed ranges are called concurrently from
+ * multiple threads and must be thread-safe.
+ * For all other ranges operations fall back to the sequential evaluation,
+ * `filter` ranges with offcast destinations, that have state (e.g. `offcast_into`,
+ * `offcast_batch` or capturing lambdas), are also evaluated sequentially.
+ */
+class parallel_policy {
+    unsigned threads_count;
+    std::size_t min_chunk;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param threads_count max number of threads to use, `0` means
+     *        the number of hardware threads
+     * @param min_chunk_size min number of source elements to process
+     *        in a single thread
+     */
+    explicit parallel_policy(unsigned threads_count = 0, std::size_t min_chunk_size = 4096) :
+    threads_count(threads_count),
+    min_chunk(min_chunk_size > 0 ? min_chunk_size : 1) { }
+
+    /**
+     * Max number of threads to use
+     *
+     * @return number of threads
+     */
+    unsigned threads() const {
+        if (threads_count > 0) {
+            return threads_count;
+        }
+        unsigned hc = std::thread::hardware_concurrency();
+        return hc > 0 ? hc : 1;
+    }
+
+    /**
+     * Min number of source elements to process in a single thread
+     *
+     * @return min number of elements
+     */
+    std::size_t min_chunk_size() const {
+        return min_chunk;
+    }
+
+    /**
+     * Number of chunks to split the source with specified size into
+     *
+     * @param size number of source elements
+     * @return number of chunks, at least one
+     */
+    std::size_t chunks_count(std::size_t size) const {
+        std::size_t by_size = (size + min_chunk - 1) / min_chunk;
+        return (std::max)(std::size_t(1), (std::min)(by_size, std::size_t(threads())));
+    }
+};
+
+namespace detail_parallel {
+
+/**
+ * Bounds of a contiguous chunk of source index space
+ */
+struct chunk_bounds {
+    std::size_t from;
+    std::size_t to;
+};
+
+inline chunk_bounds bounds(std::size_t size, std::size_t chunks, std::size_t idx) {
+    std::size_t base = size / chunks;
+    std::size_t extra = size % chunks;
+    std::size_t from = idx * base + (std::min)(idx, extra);
+    std::size_t to = from + base + (idx < extra ? 1 : 0);
+    return chunk_bounds{from, to};
+}
+
+/**
+ * Calls specified `FunctionObject` with the index of each chunk, first chunk
+ * is processed on the calling thread, others - on the separate threads.
+ * Waits for all the chunks to complete, first exception thrown from
+ * the `FunctionObject` is rethrown to the caller.
+ *
+ * @param chunks number of chunks
+ * @param fun `FunctionObject` to call with chunk index
+ */
+template<typename Func>
+void run_chunks(std::size_t chunks, Func& fun) {
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto guarded = [&fun, &error, &error_mutex](std::size_t idx) {
+        try {
+            fun(idx);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    auto workers = std::vector<std::thread>();
+    workers.reserve(chunks);
+    try {
+        for (std::size_t i = 1; i < chunks; i++) {
+            workers.emplace_back(guarded, i);
+        }
+    } catch (...) {
+        // thread creation failed, remaining chunks are processed on the calling thread
+        for (std::size_t i = workers.size() + 1; i < chunks; i++) {
+            guarded(i);
+        }
+    }
+    guarded(0);
+    for (auto& th : workers) {
+        th.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * Sink that move-assigns elements into pre-sized output starting from
+ * the specified position
+ */
+template<typename Elem>
+class assigning_sink {
+    Elem* out;
+
+public:
+    assigning_sink(Elem* out) :
+    out(out) { }
+
+    template<typename Other>
+    bool operator()(Other&& el) {
+        *out = std::move(el);
+        ++out;
+        return true;
+    }
+};
+
+template<typename Elem>
+struct is_presizable {
+    // std::vector<bool> does not provide access to its storage
+    static const bool value = std::is_default_constructible<Elem>::value &&
+            std::is_move_assignable<Elem>::value &&
+            !std::is_same<Elem, bool>::value;
+};
+
+template<typename Elem, typename Range>
+std::vector<Elem> to_vector_presized(Range& range, std::size_t size, std::size_t chunks, std::true_type) {
+    auto vec = std::vector<Elem>(size);
+    auto fun = [&range, &vec, size, chunks](std::size_t idx) {
+        auto bs = bounds(size, chunks, idx);
+        auto sink = assigning_sink<Elem>(vec.data() + bs.from);
+        detail_fusion::fused_for_each_slice(range, sink, bs.from, bs.to);
+    };
+    run_chunks(chunks, fun);
+    return vec;
+}
+
+template<typename Elem, typename Range>
+std::vector<Elem> to_vector_presized(Range&, std::size_t, std::size_t, std::false_type) {
+    // never called, element type cannot be pre-sized
+    return std::vector<Elem>();
+}
+
+template<typename Elem, typename Range>
+std::vector<Elem> to_vector_chunked(Range& range, std::size_t size, std::size_t chunks) {
+    auto parts = std::vector<std::vector<Elem>>(chunks);
+    auto hint = get_size_hint(range);
+    auto fun = [&range, &parts, &hint, size, chunks](std::size_t idx) {
+        auto bs = bounds(size, chunks, idx);
+        auto& part = parts[idx];
+        reserve_for(part, hint.is_known() ? size_hint::upper_bound(bs.to - bs.from) : hint);
+        auto sink = detail_fusion::emplacing_sink<std::vector<Elem>>(part);
+        detail_fusion::fused_for_each_slice(range, sink, bs.from, bs.to);
+    };
+    run_chunks(chunks, fun);
+    std::size_t total = 0;
+    for (auto& part : parts) {
+        total += part.size();
+    }
+    auto vec = std::vector<Elem>();
+    vec.reserve(total);
+    for (auto& part : parts) {
+        std::move(part.begin(), part.end(), std::back_inserter(vec));
+        part = std::vector<Elem>();
+    }
+    return vec;
+}
+
+template<typename Elem, typename Range>
+std::vector<Elem> to_vector(Range& range, const parallel_policy& policy, std::true_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    std::size_t chunks = policy.chunks_count(size);
+    if (1 == chunks) {
+        return range.to_vector();
+    }
+    auto hint = get_size_hint(range);
+    if (is_presizable<Elem>::value && hint.is_exact() && size == hint.value()) {
+        // one-to-one wrappers only, each chunk writes straight into its part of the output
+        return to_vector_presized<Elem>(range, size, chunks,
+                std::integral_constant<bool, is_presizable<Elem>::value>());
+    }
+    return to_vector_chunked<Elem>(range, size, chunks);
+}
+
+template<typename Elem, typename Range>
+std::vector<Elem> to_vector(Range& range, const parallel_policy&, std::false_type) {
+    return range.to_vector();
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_PARALLEL_HPP */
@@ -0,0 +1,361 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   prefetch.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 8:40 PM
+ */
+
+#ifndef STATICLIB_RANGES_PREFETCH_HPP
+#define STATICLIB_RANGES_PREFETCH_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_prefetch {
+
+// assumed size of the cache line, used to keep producer
+// and consumer indices on separate lines
+const std::size_t cache_line_size = 64;
+
+/**
+ * Waiting strategy for the ring buffer sides: short spinning with yields,
+ * then sleeping with fixed interval, so slow upstream (e.g. blocking IO)
+ * does not keep the waiting thread busy
+ */
+class backoff {
+    unsigned count = 0;
+
+public:
+    void wait() {
+        if (count < 64) {
+            count += 1;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+};
+
+inline std::size_t ring_size(std::size_t capacity) {
+    // highest power of two, that fits into size_t
+    const std::size_t max_size = (std::numeric_limits<std::size_t>::max() >> 1) + 1;
+    if (capacity > max_size) {
+        throw std::length_error("Invalid prefetch capacity requested, capacity: [" + std::to_string(capacity) + "]");
+    }
+    std::size_t res = 1;
+    while (res < capacity) {
+        res <<= 1;
+    }
+    return res;
+}
+
+/**
+ * Prefetch state shared between the consumer (range) and the producer thread.
+ * Elements are passed through bounded lock-free single-producer/single-consumer
+ * ring buffer, indices are increasing counters, slot index is counter modulo
+ * ring size (power of two).
+ */
+template<typename Range, typename Elem>
+class state {
+    using slot_type = typename std::aligned_storage<sizeof(Elem), std::alignment_of<Elem>::value>::type;
+
+    // consumer side
+    std::atomic<std::size_t> head;
+    std::size_t cached_tail = 0;
+    char head_padding[cache_line_size];
+
+    // producer side
+    std::atomic<std::size_t> tail;
+    std::size_t cached_head = 0;
+    char tail_padding[cache_line_size];
+
+    std::atomic<bool> stop_requested;
+    std::atomic<bool> finished;
+    // written by producer before `finished` is set
+    std::exception_ptr error;
+
+    Range source_range;
+    std::size_t mask;
+    std::unique_ptr<slot_type[]> slots;
+    std::thread producer;
+
+public:
+    state(Range&& source_range, std::size_t capacity) :
+    head(0),
+    tail(0),
+    stop_requested(false),
+    finished(false),
+    source_range(std::move(source_range)),
+    mask(ring_size(capacity) - 1),
+    slots(new slot_type[mask + 1]) {
+        (void) head_padding;
+        (void) tail_padding;
+    }
+
+    state(const state&) = delete;
+
+    state& operator=(const state&) = delete;
+
+    ~state() {
+        stop_requested.store(true, std::memory_order_release);
+        if (producer.joinable()) {
+            producer.join();
+        }
+        std::size_t t = tail.load(std::memory_order_acquire);
+        for (std::size_t h = head.load(std::memory_order_relaxed); h != t; h++) {
+            slot(h)->~Elem();
+        }
+    }
+
+    bool started() const {
+        return producer.joinable();
+    }
+
+    size_hint source_hint() const {
+        return staticlib::ranges::get_size_hint(source_range);
+    }
+
+    void start() {
+        producer = std::thread([this] {
+            this->produce();
+        });
+    }
+
+    // called from consumer thread, returns false when source is exhausted
+    template<typename Func>
+    bool pop(Func& consume) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == cached_tail) {
+            auto bo = backoff();
+            for (;;) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (h != cached_tail) {
+                    break;
+                }
+                if (finished.load(std::memory_order_acquire)) {
+                    // element may be pushed right before finish
+                    cached_tail = tail.load(std::memory_order_acquire);
+                    if (h != cached_tail) {
+                        break;
+                    }
+                    if (error) {
+                        std::exception_ptr err = error;
+                        error = std::exception_ptr();
+                        std::rethrow_exception(err);
+                    }
+                    return false;
+                }
+                bo.wait();
+            }
+        }
+        Elem* el = slot(h);
+        consume(std::move(*el));
+        el->~Elem();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // called from producer thread, returns false when consumer requested stop
+    bool push(Elem&& el) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cached_head > mask) {
+            auto bo = backoff();
+            for (;;) {
+                cached_head = head.load(std::memory_order_acquire);
+                if (t - cached_head <= mask) {
+                    break;
+                }
+                if (stop_requested.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                bo.wait();
+            }
+        }
+        if (stop_requested.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        new (slot(t)) Elem(std::move(el));
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    Elem* slot(std::size_t idx) {
+        return reinterpret_cast<Elem*>(std::addressof(slots[idx & mask]));
+    }
+
+    void produce() {
+        try {
+            auto sink = pushing_sink(*this);
+            staticlib::ranges::fused_for_each(source_range, sink);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        finished.store(true, std::memory_order_release);
+    }
+
+    class pushing_sink {
+        state* st;
+
+    public:
+        pushing_sink(state& st) :
+        st(std::addressof(st)) { }
+
+        template<typename Other>
+        bool operator()(Other&& el) {
+            return st->push(Elem(std::move(el)));
+        }
+    };
+};
+
+} // namespace
+
+/**
+ * Range, that runs source range on a dedicated producer thread and passes
+ * its elements to the consumer through a bounded lock-free single-producer/single-consumer
+ * ring buffer. Producer thread is started on `begin()` call, all the source range
+ * operations (including nested wrappers, that are evaluated in a single fused loop)
+ * are run on the producer thread.
+ *
+ * Exception thrown by the source range is rethrown to the consumer after all the elements
+ * produced before it are consumed. When the range is destroyed before the source is exhausted,
+ * producer is stopped on the next element push and joined (producer blocked inside
+ * the source range operation is joined after this operation returns).
+ */
+template<typename Range>
+class prefetched_range : public range_adapter<prefetched_range<Range>,
+        typename std::decay<decltype(*std::declval<Range&>().begin())>::type> {
+    using elem_type = typename std::decay<decltype(*std::declval<Range&>().begin())>::type;
+    using state_type = detail_prefetch::state<Range, elem_type>;
+
+    // heap-allocated to be accessible from producer thread after move
+    std::unique_ptr<state_type> st;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param capacity max number of prefetched elements, rounded up to the power of two
+     */
+    prefetched_range(Range&& source_range, std::size_t capacity) :
+    st(new state_type(std::move(source_range), capacity)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    prefetched_range(const prefetched_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    prefetched_range& operator=(const prefetched_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    prefetched_range(prefetched_range&& other) :
+    range_adapter<prefetched_range<Range>, elem_type>(std::move(other)),
+    st(std::move(other.st)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    prefetched_range& operator=(prefetched_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range, unknown after
+     * the producer thread is started
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        if (!st || st->started()) {
+            return size_hint::unknown();
+        }
+        return st->source_hint();
+    }
+
+    /**
+     * Takes next element from the ring buffer, starts producer thread on the first call
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        if (!st->started()) {
+            st->start();
+        }
+        auto consume = [this](elem_type&& el) {
+            this->set_current(std::move(el));
+        };
+        return st->pop(consume);
+    }
+};
+
+/**
+ * Lazily runs input range on a dedicated producer thread, passing its elements
+ * to the consumer through a bounded lock-free ring buffer, see `prefetched_range`.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ * Source range must not be accessed from other threads while prefetched range is iterated.
+ *
+ * @param range source range
+ * @param capacity max number of prefetched elements, rounded up to the power of two
+ * @return prefetched range
+ * @throws std::length_error if the ring buffer of the required size cannot be addressed
+ */
+template<typename Range>
+prefetched_range<typename detail_refwrap::adapted<Range>::type> prefetch(Range&& range,
+        std::size_t capacity = 1024) {
+    return prefetched_range<typename detail_refwrap::adapted<Range>::type>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)), capacity);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_PREFETCH_HPP */
@@ -30,6 +30,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "staticlib/ranges/size_hint.hpp"
+
 namespace staticlib {
 namespace ranges {
 
@@ -150,7 +152,8 @@ public:
  * `compute_next` that should set next element as `current` using 
  * `set_current` and return `true`, or return `false` if range is exhausted.
  * Inheritors should use CRTP - `compute_next` will be called using compile-time
- * polymorphism.
+ * polymorphism. Inheritors that know the number of remaining elements may
+ * additionally implement `size_hint get_size_hint() const` method.
  */
 template <typename Range, typename Elem>
 class range_adapter {
@@ -24,33 +24,655 @@
 #ifndef STATICLIB_RANGES_RANGES_UTILS_HPP
 #define STATICLIB_RANGES_RANGES_UTILS_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <iterator>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/parallel.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
 namespace staticlib {
 namespace ranges {
 
+namespace detail_utils {
+
+/**
+ * Sink for `any` operation, stops on the first matched element
+ */
+template<typename Pred>
+class any_sink {
+    Pred* predicate;
+    bool matched = false;
+
+public:
+    any_sink(Pred& predicate) :
+    predicate(std::addressof(predicate)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        if ((*predicate)(ref)) {
+            matched = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool is_matched() const {
+        return matched;
+    }
+};
+
+/**
+ * Sink for `find` operation, stops on the first matched element
+ * and moves it into the internal storage
+ */
+template<typename Pred, typename Elem>
+class find_sink {
+    Pred* predicate;
+    // space for placement of Elem instance (to not require DefaultConstructible)
+    typename std::aligned_storage<sizeof(Elem), std::alignment_of<Elem>::value>::type found_space;
+    Elem* found_ptr = nullptr;
+
+public:
+    find_sink(Pred& predicate) :
+    predicate(std::addressof(predicate)) { }
+
+    find_sink(const find_sink&) = delete;
+
+    find_sink& operator=(const find_sink&) = delete;
+
+    ~find_sink() {
+        if (found_ptr) {
+            found_ptr->~Elem();
+        }
+    }
+
+    template<typename Other>
+    bool operator()(Other&& el) {
+        auto& ref = el;
+        if ((*predicate)(ref)) {
+            found_ptr = new (std::addressof(found_space)) Elem(std::move(el));
+            return false;
+        }
+        return true;
+    }
+
+    Elem* found() {
+        return found_ptr;
+    }
+};
+
+/**
+ * Sink for `fold` operation, accumulates all the elements
+ */
+template<typename T, typename Op>
+class fold_sink {
+    T* acc;
+    Op* op;
+
+public:
+    fold_sink(T& acc, Op& op) :
+    acc(std::addressof(acc)),
+    op(std::addressof(op)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        *acc = (*op)(std::move(*acc), std::move(el));
+        return true;
+    }
+};
+
+/**
+ * Sink for `count` operation, counts elements matched by predicate
+ */
+template<typename Pred>
+class count_sink {
+    Pred* predicate;
+    std::size_t counter = 0;
+
+public:
+    count_sink(Pred& predicate) :
+    predicate(std::addressof(predicate)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        if ((*predicate)(ref)) {
+            counter += 1;
+        }
+        return true;
+    }
+
+    std::size_t count() const {
+        return counter;
+    }
+};
+
+/**
+ * Checks whether candidate is better than the current best element,
+ * strict comparisons are used, so the first of the equal elements is kept
+ */
+template<bool Max, typename Comp, typename A, typename B>
+bool better(Comp& comp, A& candidate, B& current) {
+    return Max ? comp(current, candidate) : comp(candidate, current);
+}
+
+/**
+ * Finds the first best element (according to comparator) in `[it, end)`
+ * without moving the elements
+ *
+ * @return iterator pointing to the best element, `end` if range is empty
+ */
+template<bool Max, typename Comp, typename Iter>
+Iter best_in(Iter it, Iter end, Comp& comp) {
+    Iter res = end;
+    for (; it != end; ++it) {
+        if (res == end || better<Max>(comp, *it, *res)) {
+            res = it;
+        }
+    }
+    return res;
+}
+
+/**
+ * Returns a copy of the best element found in the source range,
+ * move-only elements are moved
+ */
+template<typename Elem, typename T>
+auto take_best(T& el) -> typename std::enable_if<std::is_constructible<Elem, const T&>::value, Elem>::type {
+    return Elem(static_cast<const T&>(el));
+}
+
+template<typename Elem, typename T>
+auto take_best(T& el) -> typename std::enable_if<!std::is_constructible<Elem, const T&>::value, Elem>::type {
+    return Elem(std::move(el));
+}
+
+/**
+ * Sink for `min_element` and `max_element` operations, keeps the first
+ * best element (according to comparator) in the internal storage
+ */
+template<typename Elem, typename Comp, bool Max>
+class best_sink {
+    Comp* comp;
+    // space for placement of Elem instance (to not require DefaultConstructible)
+    typename std::aligned_storage<sizeof(Elem), std::alignment_of<Elem>::value>::type best_space;
+    Elem* best_ptr = nullptr;
+
+public:
+    best_sink(Comp& comp) :
+    comp(std::addressof(comp)) { }
+
+    best_sink(const best_sink&) = delete;
+
+    best_sink& operator=(const best_sink&) = delete;
+
+    ~best_sink() {
+        if (best_ptr) {
+            best_ptr->~Elem();
+        }
+    }
+
+    template<typename Other>
+    bool operator()(Other&& el) {
+        auto& ref = el;
+        if (!best_ptr) {
+            best_ptr = new (std::addressof(best_space)) Elem(std::move(el));
+        } else if (better<Max>(*comp, ref, *best_ptr)) {
+            *best_ptr = std::move(el);
+        }
+        return true;
+    }
+
+    Elem* best() {
+        return best_ptr;
+    }
+};
+
+/**
+ * Default comparator for `min_element` and `max_element`
+ */
+struct less {
+    template<typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+        return a < b;
+    }
+};
+
+/**
+ * Default operation and combiner for `sum`
+ */
+struct plus {
+    template<typename A, typename B>
+    A operator()(A&& a, B&& b) const {
+        return a + b;
+    }
+};
+
 /**
- * Moves all the elements from the specified range into vector using `emplace_back`
+ * Predicate for `count` without predicate
+ */
+struct always {
+    template<typename Elem>
+    bool operator()(const Elem&) const {
+        return true;
+    }
+};
+
+/**
+ * Result type of `sum` operation, `std::reference_wrapper` elements are unwrapped
+ */
+template<typename Elem>
+struct sum_type {
+    using type = Elem;
+};
+
+template<typename T>
+struct sum_type<std::reference_wrapper<T>> {
+    using type = typename std::remove_const<T>::type;
+};
+
+template<typename Range>
+struct is_not_policy {
+    static const bool value = !std::is_same<typename std::decay<Range>::type, parallel_policy>::value;
+};
+
+template<typename Range>
+using elem_type = typename std::iterator_traits<decltype(std::declval<Range&>().begin())>::value_type;
+
+/**
+ * Type trait to detect ranges (e.g. containers), whose multi-pass iterators return
+ * elements by reference to the stable storage, such elements can be compared
+ * in place and must not be moved from
+ */
+template<typename Range>
+struct is_referenced {
+private:
+    using iter_type = decltype(std::declval<Range&>().begin());
+
+public:
+    static const bool value = std::is_lvalue_reference<decltype(*std::declval<iter_type&>())>::value &&
+            std::is_base_of<std::forward_iterator_tag, typename iterator_traversal<iter_type>::type>::value;
+};
+
+template<typename T, typename Range, typename Op, typename Combine>
+T fold(const parallel_policy&, Range& range, T identity, Op& op, Combine&, std::false_type) {
+    auto sink = fold_sink<T, Op>(identity, op);
+    fused_for_each(range, sink);
+    return identity;
+}
+
+template<typename T, typename Range, typename Op, typename Combine>
+T fold(const parallel_policy& policy, Range& range, T identity, Op& op, Combine& combine, std::true_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    std::size_t chunks = policy.chunks_count(size);
+    if (1 == chunks) {
+        return detail_utils::fold(policy, range, std::move(identity), op, combine, std::false_type());
+    }
+    auto parts = std::vector<T>(chunks, identity);
+    auto fun = [&range, &parts, &op, size, chunks](std::size_t idx) {
+        auto bs = detail_parallel::bounds(size, chunks, idx);
+        auto sink = fold_sink<T, Op>(parts[idx], op);
+        detail_fusion::fused_for_each_slice(range, sink, bs.from, bs.to);
+    };
+    detail_parallel::run_chunks(chunks, fun);
+    // partial results are combined in order, combiner is not required to be commutative
+    T res = std::move(parts[0]);
+    for (std::size_t i = 1; i < chunks; i++) {
+        res = combine(std::move(res), std::move(parts[i]));
+    }
+    return res;
+}
+
+template<typename Range, typename Pred>
+std::size_t count(const parallel_policy&, Range& range, Pred& predicate, std::false_type) {
+    auto sink = count_sink<Pred>(predicate);
+    fused_for_each(range, sink);
+    return sink.count();
+}
+
+template<typename Range, typename Pred>
+std::size_t count(const parallel_policy& policy, Range& range, Pred& predicate, std::true_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    std::size_t chunks = policy.chunks_count(size);
+    if (1 == chunks) {
+        return detail_utils::count(policy, range, predicate, std::false_type());
+    }
+    // each chunk counts its elements (taken by reference) separately, counts are added
+    auto parts = std::vector<std::size_t>(chunks, 0);
+    auto fun = [&range, &parts, &predicate, size, chunks](std::size_t idx) {
+        auto bs = detail_parallel::bounds(size, chunks, idx);
+        auto sink = count_sink<Pred>(predicate);
+        detail_fusion::fused_for_each_slice(range, sink, bs.from, bs.to);
+        parts[idx] = sink.count();
+    };
+    detail_parallel::run_chunks(chunks, fun);
+    std::size_t res = 0;
+    for (std::size_t part : parts) {
+        res += part;
+    }
+    return res;
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best(Range& range, Elem& not_found_el, Comp& comp, std::false_type) {
+    best_sink<Elem, Comp, Max> sink(comp);
+    fused_for_each(range, sink);
+    if (sink.best()) {
+        return std::move(*sink.best());
+    }
+    return std::move(not_found_el);
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best(Range& range, Elem& not_found_el, Comp& comp, std::true_type) {
+    // elements are compared in place, only the result is copied
+    auto end = range.end();
+    auto it = best_in<Max>(range.begin(), end, comp);
+    if (it != end) {
+        return take_best<Elem>(*it);
+    }
+    return std::move(not_found_el);
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best(Range& range, Elem& not_found_el, Comp& comp) {
+    return best<Elem, Comp, Max>(range, not_found_el, comp,
+            std::integral_constant<bool, is_referenced<Range>::value>());
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best_slices(const parallel_policy& policy, Range& range, Elem& not_found_el, Comp& comp, std::false_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    std::size_t chunks = policy.chunks_count(size);
+    auto parts = std::vector<std::unique_ptr<best_sink<Elem, Comp, Max>>>();
+    for (std::size_t i = 0; i < chunks; i++) {
+        parts.emplace_back(new best_sink<Elem, Comp, Max>(comp));
+    }
+    auto fun = [&range, &parts, size, chunks](std::size_t idx) {
+        auto bs = detail_parallel::bounds(size, chunks, idx);
+        detail_fusion::fused_for_each_slice(range, *parts[idx], bs.from, bs.to);
+    };
+    detail_parallel::run_chunks(chunks, fun);
+    // chunks are merged in order, the first of the equal elements is kept
+    auto& res = *parts[0];
+    for (std::size_t i = 1; i < chunks; i++) {
+        Elem* el = parts[i]->best();
+        if (el) {
+            res(std::move(*el));
+        }
+    }
+    if (res.best()) {
+        return std::move(*res.best());
+    }
+    return std::move(not_found_el);
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best_slices(const parallel_policy& policy, Range& range, Elem& not_found_el, Comp& comp, std::true_type) {
+    using iter_type = decltype(range.begin());
+    using diff_type = typename std::iterator_traits<iter_type>::difference_type;
+    std::size_t size = detail_fusion::get_slice_size(range);
+    std::size_t chunks = policy.chunks_count(size);
+    // elements are compared in place, iterators to the best elements of the chunks are kept
+    auto end = range.end();
+    auto parts = std::vector<iter_type>(chunks, end);
+    auto fun = [&range, &parts, &comp, size, chunks](std::size_t idx) {
+        auto bs = detail_parallel::bounds(size, chunks, idx);
+        auto from = range.begin() + static_cast<diff_type>(bs.from);
+        auto to = range.begin() + static_cast<diff_type>(bs.to);
+        auto it = best_in<Max>(from, to, comp);
+        if (it != to) {
+            parts[idx] = it;
+        }
+    };
+    detail_parallel::run_chunks(chunks, fun);
+    // chunks are merged in order, the first of the equal elements is kept
+    auto res = end;
+    for (auto& it : parts) {
+        if (it != end && (res == end || better<Max>(comp, *it, *res))) {
+            res = it;
+        }
+    }
+    if (res != end) {
+        return take_best<Elem>(*res);
+    }
+    return std::move(not_found_el);
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best(const parallel_policy& policy, Range& range, Elem& not_found_el, Comp& comp, std::true_type) {
+    return best_slices<Elem, Comp, Max>(policy, range, not_found_el, comp, std::integral_constant<bool,
+            is_referenced<Range>::value && is_random_access_iterator<decltype(range.begin())>::value>());
+}
+
+template<typename Elem, typename Comp, bool Max, typename Range>
+Elem best(const parallel_policy&, Range& range, Elem& not_found_el, Comp& comp, std::false_type) {
+    return best<Elem, Comp, Max>(range, not_found_el, comp);
+}
+
+/**
+ * Shared state of the parallel `any` and `find` operations, workers take small blocks
+ * of the source index space in increasing order and stop as soon as the match is found
+ * (in ordered mode - as soon as the match is found in one of the preceding blocks).
+ * Matched element is stored only when `Elem` is not `void`.
+ */
+template<typename Elem>
+class parallel_find_state {
+    using stored_type = typename std::conditional<std::is_void<Elem>::value, bool, Elem>::type;
+
+    std::atomic<std::size_t> next_block;
+    std::atomic<std::size_t> found_block;
+    std::mutex mutex;
+    bool matched = false;
+    std::unique_ptr<stored_type> found_el;
+    std::size_t size;
+    std::size_t block_size;
+    std::size_t blocks_count;
+    bool ordered;
+
+public:
+    parallel_find_state(std::size_t size, std::size_t block_size, bool ordered) :
+    next_block(0),
+    found_block(no_block()),
+    size(size),
+    block_size(block_size),
+    blocks_count((size + block_size - 1) / block_size),
+    ordered(ordered) { }
+
+    template<typename Range, typename Pred>
+    void run(Range& range, Pred& predicate) {
+        try {
+            for (;;) {
+                std::size_t block = next_block.fetch_add(1);
+                // blocks are taken in increasing order, the following blocks cannot contain better match
+                if (block >= blocks_count || block > found_block.load()) {
+                    return;
+                }
+                std::size_t from = block * block_size;
+                std::size_t to = (std::min)(from + block_size, size);
+                if (check_block(range, predicate, block, from, to) && !ordered) {
+                    return;
+                }
+            }
+        } catch (...) {
+            // cancel other workers
+            found_block.store(0);
+            throw;
+        }
+    }
+
+    bool is_matched() const {
+        return matched;
+    }
+
+    stored_type* found() {
+        return found_el.get();
+    }
+
+private:
+    static std::size_t no_block() {
+        return static_cast<std::size_t>(-1);
+    }
+
+    template<typename Range, typename Pred, typename E = Elem>
+    typename std::enable_if<std::is_void<E>::value, bool>::type check_block(Range& range, Pred& predicate,
+            std::size_t block, std::size_t from, std::size_t to) {
+        any_sink<Pred> sink(predicate);
+        detail_fusion::fused_for_each_slice(range, sink, from, to);
+        if (sink.is_matched()) {
+            std::lock_guard<std::mutex> guard(mutex);
+            set_found(block);
+        }
+        return sink.is_matched();
+    }
+
+    template<typename Range, typename Pred, typename E = Elem>
+    typename std::enable_if<!std::is_void<E>::value, bool>::type check_block(Range& range, Pred& predicate,
+            std::size_t block, std::size_t from, std::size_t to) {
+        find_sink<Pred, E> sink(predicate);
+        detail_fusion::fused_for_each_slice(range, sink, from, to);
+        if (sink.found()) {
+            std::lock_guard<std::mutex> guard(mutex);
+            if (set_found(block)) {
+                found_el.reset(new E(std::move(*sink.found())));
+            }
+        }
+        return nullptr != sink.found();
+    }
+
+    // called under the lock
+    bool set_found(std::size_t block) {
+        if (!matched || (ordered && block < found_block.load())) {
+            this->matched = true;
+            // unordered mode, all workers are stopped
+            found_block.store(ordered ? block : 0);
+            return true;
+        }
+        return false;
+    }
+};
+
+template<typename Elem, typename Range, typename Pred>
+void run_find(parallel_find_state<Elem>& state, const parallel_policy& policy, Range& range,
+        Pred& predicate, std::size_t size) {
+    std::size_t threads = policy.chunks_count(size);
+    auto fun = [&range, &predicate, &state](std::size_t) {
+        state.run(range, predicate);
+    };
+    detail_parallel::run_chunks(threads, fun);
+}
+
+// small blocks, so cancellation is checked often enough
+inline std::size_t find_block_size(const parallel_policy& policy) {
+    return (std::max)(std::size_t(1), policy.min_chunk_size() / 16);
+}
+
+template<typename Range, typename Pred>
+bool any(const parallel_policy& policy, Range& range, Pred& predicate, std::true_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    parallel_find_state<void> state(size, find_block_size(policy), false);
+    run_find(state, policy, range, predicate, size);
+    return state.is_matched();
+}
+
+template<typename Range, typename Pred>
+bool any(const parallel_policy&, Range& range, Pred& predicate, std::false_type) {
+    any_sink<Pred> sink(predicate);
+    fused_for_each(range, sink);
+    return sink.is_matched();
+}
+
+template<typename Elem, typename Range, typename Pred>
+Elem find(const parallel_policy& policy, Range& range, Pred& predicate, Elem& not_found_el,
+        bool ordered, std::true_type) {
+    std::size_t size = detail_fusion::get_slice_size(range);
+    parallel_find_state<Elem> state(size, find_block_size(policy), ordered);
+    run_find(state, policy, range, predicate, size);
+    if (state.found()) {
+        return std::move(*state.found());
+    }
+    return std::move(not_found_el);
+}
+
+template<typename Elem, typename Range, typename Pred>
+Elem find(const parallel_policy&, Range& range, Pred& predicate, Elem& not_found_el,
+        bool, std::false_type) {
+    find_sink<Pred, Elem> sink(predicate);
+    fused_for_each(range, sink);
+    if (sink.found()) {
+        return std::move(*sink.found());
+    }
+    return std::move(not_found_el);
+}
+
+} // namespace
+
+/**
+ * Moves all the elements from the specified range into vector using `emplace_back`.
+ * Chains of wrappers from this library are evaluated in a single fused loop,
+ * see `fused_for_each`.
  * 
  * @param range range with `MoveConstructible` elements
  * @return vector containing all element from specified range
  */
 template <typename Range, class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
 auto emplace_to_vector(Range&& range) -> std::vector<typename std::iterator_traits<decltype(range.begin())>::value_type> {
-    auto vec = std::vector<typename std::iterator_traits<decltype(range.begin())>::value_type>{};
-    // resize is not used here, as neither 'transformed' nor 'filtered' 
-    // range will have O(1) size available
-    for (auto&& el : range) {
-        vec.emplace_back(std::move(el));
-    }
-    return vec;
+    return detail_fusion::collect(range,
+            std::vector<typename std::iterator_traits<decltype(range.begin())>::value_type>());
+}
+
+/**
+ * Moves all the elements from the specified range into vector, that uses
+ * specified allocator (e.g. arena allocator) for its storage, using `emplace_back`.
+ * Chains of wrappers from this library are evaluated in a single fused loop,
+ * see `fused_for_each`.
+ *
+ * @param range range with `MoveConstructible` elements
+ * @param alloc allocator, rebound to the element type
+ * @return vector containing all element from specified range
+ */
+template <typename Range, typename Alloc, class = typename std::enable_if<
+        !std::is_lvalue_reference<Range>::value && is_allocator<Alloc>::value>::type>
+auto emplace_to_vector(Range&& range, const Alloc& alloc) -> typename allocated_vector<
+        typename std::iterator_traits<decltype(range.begin())>::value_type, Alloc>::type {
+    return detail_fusion::collect_allocated<
+            typename std::iterator_traits<decltype(range.begin())>::value_type>(range, alloc);
+}
+
+#ifdef STATICLIB_RANGES_PMR
+/**
+ * Moves all the elements from the specified range into vector, that uses
+ * specified memory resource (e.g. `std::pmr::monotonic_buffer_resource`)
+ * for its storage, using `emplace_back`.
+ * Chains of wrappers from this library are evaluated in a single fused loop,
+ * see `fused_for_each`.
+ *
+ * @param range range with `MoveConstructible` elements
+ * @param resource memory resource
+ * @return vector containing all element from specified range
+ */
+template <typename Range, class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
+auto emplace_to_vector(Range&& range, std::pmr::memory_resource* resource) -> std::pmr::vector<
+        typename std::iterator_traits<decltype(range.begin())>::value_type> {
+    return emplace_to_vector(std::move(range), std::pmr::polymorphic_allocator<
+            typename std::iterator_traits<decltype(range.begin())>::value_type>(resource));
 }
+#endif // STATICLIB_RANGES_PMR
 
 /**
  * Moves all the elements from the specified range into specified destination
- * using `emplace_back`.
+ * using `emplace_back`. Space in destination is reserved up front when
+ * range size hint is available and destination supports `reserve`.
  * 
  * @param dest destination container
  * @param range source range
@@ -59,9 +681,9 @@ auto emplace_to_vector(Range&& range) -> std::vector<typename std::iterator_trai
 template <typename Dest, typename Range,
         class = typename std::enable_if<!std::is_lvalue_reference<Range>::value>::type>
 Dest& emplace_to(Dest& dest, Range&& range) {
-    for (auto&& el : range) {
-        dest.emplace_back(std::move(el));
-    }
+    reserve_for(dest, get_size_hint(range));
+    auto sink = detail_fusion::emplacing_sink<Dest>(dest);
+    fused_for_each(range, sink);
     return dest;
 }
 
@@ -76,6 +698,186 @@ void ignore_offcast(Elem el) {
     (void) el; // ignored
 }
 
+/**
+ * Offcast `FunctionObject` for `filter` function, that emplaces all offcast
+ * elements into the destination container. Unlike `std::function` it can be
+ * inlined into the filtering loop, it is still convertible to `std::function<void(Elem)>`.
+ * Destination container is not synchronized, parallel operations (see `parallel_policy`)
+ * process `filter` ranges with `offcast_emplacer` sequentially.
+ */
+template <typename Dest, typename Elem = typename Dest::value_type>
+class offcast_emplacer {
+    Dest* dest;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param dest container to emplace offcast elements into
+     */
+    explicit offcast_emplacer(Dest& dest) :
+    dest(std::addressof(dest)) { }
+
+    /**
+     * Emplaces specified element into destination container
+     *
+     * @param el offcast element
+     */
+    void operator()(Elem&& el) {
+        dest->emplace_back(std::move(el));
+    }
+
+    /**
+     * Emplaces a copy of specified element into destination container
+     *
+     * @param el offcast element
+     */
+    void operator()(const Elem& el) {
+        dest->emplace_back(el);
+    }
+};
+
+/**
+ * Offcast `FunctionObject` for `filter` function, that collects offcast elements
+ * in a fixed-size buffer and appends them to the destination container in bulk
+ * with a single `insert` call, when the buffer becomes full and on `flush` call.
+ *
+ * `filter` flushes remaining elements when its source range is exhausted. When the buffer
+ * is passed to `filter` wrapped with `std::ref`, or iteration is stopped early, `flush`
+ * must be called explicitly. Destructor also tries to flush remaining elements,
+ * but exceptions thrown by destination container are not propagated from it
+ * and remaining elements are discarded in that case.
+ *
+ * Buffer is not thread-safe, parallel operations (see `parallel_policy`) process
+ * `filter` ranges with `offcast_batch` sequentially.
+ */
+template <typename Dest, std::size_t N = 64, typename Elem = typename Dest::value_type>
+class offcast_batch {
+    static_assert(N > 0, "Buffer size must be positive");
+
+    Dest* dest;
+    // space for placement of Elem instances (to not require DefaultConstructible)
+    typename std::aligned_storage<sizeof(Elem) * N, std::alignment_of<Elem>::value>::type buffer_space;
+    std::size_t count = 0;
+
+public:
+    /**
+     * Constructor
+     *
+     * @param dest container to append offcast elements to
+     */
+    explicit offcast_batch(Dest& dest) :
+    dest(std::addressof(dest)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    offcast_batch(const offcast_batch& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    offcast_batch& operator=(const offcast_batch& other) = delete;
+
+    /**
+     * Move constructor, moves buffered elements
+     *
+     * @param other other instance
+     */
+    offcast_batch(offcast_batch&& other) :
+    dest(other.dest) {
+        for (std::size_t i = 0; i < other.count; i++) {
+            new (buffer() + i) Elem(std::move(other.buffer()[i]));
+            this->count += 1;
+        }
+        other.clear();
+    }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    offcast_batch& operator=(offcast_batch&& other) = delete;
+
+    /**
+     * Destructor, flushes buffered elements on a best-effort basis,
+     * use `flush` for guaranteed delivery
+     */
+    ~offcast_batch() {
+        try {
+            flush();
+        } catch (...) {
+            // cannot be reported from destructor
+            clear();
+        }
+    }
+
+    /**
+     * Adds specified element to the buffer, flushes the buffer if it is full
+     *
+     * @param el offcast element
+     */
+    void operator()(Elem&& el) {
+        if (N == count) {
+            flush();
+        }
+        new (buffer() + count) Elem(std::move(el));
+        count += 1;
+    }
+
+    /**
+     * Adds a copy of specified element to the buffer, flushes the buffer if it is full
+     *
+     * @param el offcast element
+     */
+    void operator()(const Elem& el) {
+        if (N == count) {
+            flush();
+        }
+        new (buffer() + count) Elem(el);
+        count += 1;
+    }
+
+    /**
+     * Appends all buffered elements to the destination container
+     */
+    void flush() {
+        if (count > 0) {
+            dest->insert(dest->end(), std::make_move_iterator(buffer()),
+                    std::make_move_iterator(buffer() + count));
+            clear();
+        }
+    }
+
+    /**
+     * Number of buffered elements
+     *
+     * @return number of buffered elements
+     */
+    std::size_t size() const {
+        return count;
+    }
+
+private:
+    Elem* buffer() {
+        return reinterpret_cast<Elem*>(std::addressof(buffer_space));
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i < count; i++) {
+            buffer()[i].~Elem();
+        }
+        count = 0;
+    }
+};
+
 /**
  * Utility function to use as an offcast `FunctionObject` argument for `filter` function.
  * Emplaces all offcast elements into specified container
@@ -84,14 +886,26 @@ void ignore_offcast(Elem el) {
  * @return `FunctionObject` argument for `filter` function
  */
 template <typename Dest, typename Elem = typename Dest::value_type>
-std::function<void(Elem)> offcast_into(Dest& dest) {
-    return [&dest](Elem el) {
-        dest.emplace_back(std::move(el));
-    };
+offcast_emplacer<Dest, Elem> offcast_into(Dest& dest) {
+    return offcast_emplacer<Dest, Elem>(dest);
 }
 
 /**
- * `any` algorithm implementation for the arbitrary ranges
+ * Utility function to use as an offcast `FunctionObject` argument for `filter` function.
+ * Collects offcast elements in a fixed-size buffer and appends them to specified
+ * container in bulk, see `offcast_batch`
+ *
+ * @param dest container to append offcast elements to
+ * @return `FunctionObject` argument for `filter` function
+ */
+template <std::size_t N = 64, typename Dest>
+offcast_batch<Dest, N> offcast_batched_into(Dest& dest) {
+    return offcast_batch<Dest, N>(dest);
+}
+
+/**
+ * `any` algorithm implementation for the arbitrary ranges,
+ * chains of wrappers from this library are evaluated in a single fused loop
  * 
  * @param range input range
  * @param predicate function to check range elements with
@@ -100,18 +914,15 @@ std::function<void(Elem)> offcast_into(Dest& dest) {
  */
 template <typename Range, typename Pred>
 bool any(Range& range, Pred predicate) {
-    for (auto&& el : range) {
-        auto& ref = el;
-        if (predicate(ref)) {
-            return true;
-        }
-    }
-    return false;
+    auto sink = detail_utils::any_sink<Pred>(predicate);
+    fused_for_each(range, sink);
+    return sink.is_matched();
 }
 
 /**
  * `find` algorithm implementation for the arbitrary ranges,
- *  found element will be `move-returned` to the caller
+ *  found element will be `move-returned` to the caller,
+ *  chains of wrappers from this library are evaluated in a single fused loop
  * 
  * @param range input range
  * @param predicate function to check range elements with
@@ -122,13 +933,249 @@ bool any(Range& range, Pred predicate) {
  */
 template <typename Range, typename Pred, typename Elem>
 Elem find(Range& range, Pred predicate, Elem not_found_el) {
-    for (auto&& el : range) {
-        auto& ref = el;
-        if (predicate(ref)) {
-            return std::move(el);
-        }
+    detail_utils::find_sink<Pred, Elem> sink(predicate);
+    fused_for_each(range, sink);
+    if (sink.found()) {
+        return std::move(*sink.found());
     }
-    return std::move(not_found_el);
+    return not_found_el;
+}
+
+/**
+ * Parallel `any` algorithm implementation, ranges over random-access sources are
+ * split into small blocks, that are checked by multiple threads (see `parallel_policy`),
+ * all threads are stopped as soon as one of them finds a match.
+ * Other ranges are checked sequentially.
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param predicate thread-safe function to check range elements with
+ * @return true if function returned true on some range element,
+ *         false otherwise
+ */
+template <typename Range, typename Pred>
+bool any(const parallel_policy& policy, Range& range, Pred predicate) {
+    return detail_utils::any(policy, range, predicate,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * Parallel `find` algorithm implementation, ranges over random-access sources are
+ * split into small blocks, that are checked by multiple threads (see `parallel_policy`),
+ * all threads are stopped as soon as the result is known. In ordered mode the first
+ * matched element (in range order) is returned, otherwise any of the matched elements
+ * is returned (with earlier stop). Other ranges are checked sequentially.
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param predicate thread-safe function to check range elements with
+ * @param not_found_el this element will be returned if
+ *        predicate won't match any element
+ * @param ordered whether the first matched element must be returned
+ * @return range element that will match the predicate,
+ *         `not_found_el` argument if no elements will match
+ */
+template <typename Range, typename Pred, typename Elem>
+Elem find(const parallel_policy& policy, Range& range, Pred predicate, Elem not_found_el,
+        bool ordered = true) {
+    return detail_utils::find(policy, range, predicate, not_found_el, ordered,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * `fold` (left reduction) algorithm implementation for the arbitrary ranges,
+ * accumulator is updated as `acc = op(std::move(acc), std::move(el))` for each element,
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @param init initial accumulator value
+ * @param op `FunctionObject` with signature `T(T&&, Elem&&)`
+ * @return accumulated value
+ */
+template <typename Range, typename T, typename Op>
+T fold(Range& range, T init, Op op) {
+    auto sink = detail_utils::fold_sink<T, Op>(init, op);
+    fused_for_each(range, sink);
+    return init;
+}
+
+/**
+ * Parallel `fold` algorithm implementation, ranges over random-access sources are
+ * split into chunks (see `parallel_policy`), each chunk is folded on a separate
+ * thread starting from a copy of `identity`, partial results are merged in order
+ * using the associative `combine` function. Other ranges are folded sequentially.
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param identity initial accumulator value for each chunk, must be an identity
+ *        of the `combine` function (e.g. `0` for addition)
+ * @param op thread-safe `FunctionObject` with signature `T(T&&, Elem&&)`
+ * @param combine associative `FunctionObject` with signature `T(T&&, T&&)`
+ * @return accumulated value
+ */
+template <typename Range, typename T, typename Op, typename Combine>
+T fold(const parallel_policy& policy, Range& range, T identity, Op op, Combine combine) {
+    return detail_utils::fold(policy, range, std::move(identity), op, combine,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * Sums all the elements of the specified range using `operator+`
+ * starting from value-initialized element, `std::reference_wrapper` elements are unwrapped,
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @return sum of all the elements
+ */
+template <typename Range>
+typename detail_utils::sum_type<detail_utils::elem_type<Range>>::type sum(Range& range) {
+    using sum_type = typename detail_utils::sum_type<detail_utils::elem_type<Range>>::type;
+    return fold(range, sum_type(), detail_utils::plus());
+}
+
+/**
+ * Parallel `sum` algorithm implementation, see `fold`
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @return sum of all the elements
+ */
+template <typename Range>
+typename detail_utils::sum_type<detail_utils::elem_type<Range>>::type sum(
+        const parallel_policy& policy, Range& range) {
+    using sum_type = typename detail_utils::sum_type<detail_utils::elem_type<Range>>::type;
+    return fold(policy, range, sum_type(), detail_utils::plus(), detail_utils::plus());
+}
+
+/**
+ * Counts the elements of the specified range,
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @return number of elements
+ */
+template <typename Range>
+std::size_t count(Range& range) {
+    auto predicate = detail_utils::always();
+    auto sink = detail_utils::count_sink<detail_utils::always>(predicate);
+    fused_for_each(range, sink);
+    return sink.count();
+}
+
+/**
+ * Counts the elements of the specified range matched by predicate,
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @param predicate function to check range elements with
+ * @return number of matched elements
+ */
+template <typename Range, typename Pred,
+        class = typename std::enable_if<detail_utils::is_not_policy<Range>::value>::type>
+std::size_t count(Range& range, Pred predicate) {
+    auto sink = detail_utils::count_sink<Pred>(predicate);
+    fused_for_each(range, sink);
+    return sink.count();
+}
+
+/**
+ * Parallel `count` algorithm implementation, elements of each chunk
+ * are counted separately by reference, then chunk counts are added
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @return number of elements
+ */
+template <typename Range>
+std::size_t count(const parallel_policy& policy, Range& range) {
+    auto predicate = detail_utils::always();
+    return detail_utils::count(policy, range, predicate,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * Parallel `count` algorithm implementation, elements of each chunk
+ * are counted separately by reference, then chunk counts are added
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param predicate thread-safe function to check range elements with
+ * @return number of matched elements
+ */
+template <typename Range, typename Pred>
+std::size_t count(const parallel_policy& policy, Range& range, Pred predicate) {
+    return detail_utils::count(policy, range, predicate,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * Finds the smallest element of the specified range, the first one
+ * is returned if there are multiple equal smallest elements,
+ * found element will be `move-returned` to the caller, elements of the containers
+ * are compared in place and the found one is copied (moved only if not copyable),
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @param not_found_el this element will be returned if range is empty
+ * @param comp `Compare` function, `operator<` is used by default
+ * @return smallest element, `not_found_el` argument if range is empty
+ */
+template <typename Range, typename Elem, typename Comp = detail_utils::less,
+        class = typename std::enable_if<detail_utils::is_not_policy<Range>::value>::type>
+Elem min_element(Range& range, Elem not_found_el, Comp comp = Comp()) {
+    return detail_utils::best<Elem, Comp, false>(range, not_found_el, comp);
+}
+
+/**
+ * Parallel `min_element` algorithm implementation, ranges over random-access sources are
+ * split into chunks (see `parallel_policy`), smallest elements of the chunks
+ * are merged in order.
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param not_found_el this element will be returned if range is empty
+ * @param comp thread-safe `Compare` function, `operator<` is used by default
+ * @return smallest element, `not_found_el` argument if range is empty
+ */
+template <typename Range, typename Elem, typename Comp = detail_utils::less>
+Elem min_element(const parallel_policy& policy, Range& range, Elem not_found_el, Comp comp = Comp()) {
+    return detail_utils::best<Elem, Comp, false>(policy, range, not_found_el, comp,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
+}
+
+/**
+ * Finds the largest element of the specified range, the first one
+ * is returned if there are multiple equal largest elements,
+ * found element will be `move-returned` to the caller, elements of the containers
+ * are compared in place and the found one is copied (moved only if not copyable),
+ * chains of wrappers from this library are evaluated in a single fused loop
+ *
+ * @param range input range
+ * @param not_found_el this element will be returned if range is empty
+ * @param comp `Compare` function, `operator<` is used by default
+ * @return largest element, `not_found_el` argument if range is empty
+ */
+template <typename Range, typename Elem, typename Comp = detail_utils::less,
+        class = typename std::enable_if<detail_utils::is_not_policy<Range>::value>::type>
+Elem max_element(Range& range, Elem not_found_el, Comp comp = Comp()) {
+    return detail_utils::best<Elem, Comp, true>(range, not_found_el, comp);
+}
+
+/**
+ * Parallel `max_element` algorithm implementation, ranges over random-access sources are
+ * split into chunks (see `parallel_policy`), largest elements of the chunks
+ * are merged in order.
+ *
+ * @param policy parallel execution policy
+ * @param range input range
+ * @param not_found_el this element will be returned if range is empty
+ * @param comp thread-safe `Compare` function, `operator<` is used by default
+ * @return largest element, `not_found_el` argument if range is empty
+ */
+template <typename Range, typename Elem, typename Comp = detail_utils::less>
+Elem max_element(const parallel_policy& policy, Range& range, Elem not_found_el, Comp comp = Comp()) {
+    return detail_utils::best<Elem, Comp, true>(policy, range, not_found_el, comp,
+            std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
 }
 
 
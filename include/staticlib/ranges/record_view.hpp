@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   record_view.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 11:00 PM
+ */
+
+#ifndef STATICLIB_RANGES_RECORD_VIEW_HPP
+#define STATICLIB_RANGES_RECORD_VIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Non-owning view over the bytes of a single record (line) returned
+ * from record sources, does not include delimiter. Validity of the viewed
+ * memory is specified by the source.
+ */
+class record_view {
+    const char* ptr = nullptr;
+    std::size_t len = 0;
+
+public:
+    /**
+     * Constructor for an empty view
+     */
+    record_view() { }
+
+    /**
+     * Constructor
+     *
+     * @param data pointer to the first byte of the record
+     * @param size number of bytes in the record
+     */
+    record_view(const char* data, std::size_t size) :
+    ptr(data),
+    len(size) { }
+
+    /**
+     * Constructor for a view over the string contents,
+     * allows to compare records with strings
+     *
+     * @param str string to view
+     */
+    record_view(const std::string& str) :
+    ptr(str.data()),
+    len(str.size()) { }
+
+    /**
+     * Pointer to the first byte of the record
+     *
+     * @return pointer to the first byte
+     */
+    const char* data() const {
+        return ptr;
+    }
+
+    /**
+     * Number of bytes in the record
+     *
+     * @return number of bytes
+     */
+    std::size_t size() const {
+        return len;
+    }
+
+    /**
+     * Whether this record is empty
+     *
+     * @return true if record is empty
+     */
+    bool empty() const {
+        return 0 == len;
+    }
+
+    /**
+     * Pointer to the first byte of the record
+     *
+     * @return pointer to the first byte
+     */
+    const char* begin() const {
+        return ptr;
+    }
+
+    /**
+     * Pointer past the last byte of the record
+     *
+     * @return pointer past the last byte
+     */
+    const char* end() const {
+        return ptr + len;
+    }
+
+    /**
+     * Access to the byte with the specified index
+     *
+     * @param idx byte index
+     * @return byte value
+     */
+    char operator[](std::size_t idx) const {
+        return ptr[idx];
+    }
+
+    /**
+     * Copies record bytes into a newly-allocated string
+     *
+     * @return record copy
+     */
+    std::string str() const {
+        return std::string(ptr, len);
+    }
+
+    /**
+     * Compares record bytes with the specified record
+     *
+     * @param other other record
+     * @return true if records contain the same bytes
+     */
+    bool operator==(const record_view& other) const {
+        return len == other.len && (0 == len || 0 == std::memcmp(ptr, other.ptr, len));
+    }
+
+    /**
+     * Compares record bytes with the specified record
+     *
+     * @param other other record
+     * @return true if records contain different bytes
+     */
+    bool operator!=(const record_view& other) const {
+        return !(*this == other);
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_RECORD_VIEW_HPP */
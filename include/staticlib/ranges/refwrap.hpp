@@ -24,33 +24,39 @@
 #ifndef STATICLIB_RANGES_REFWRAP_HPP
 #define STATICLIB_RANGES_REFWRAP_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
+#include "staticlib/ranges/delegated_iter.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
 namespace staticlib {
 namespace ranges {
 
 namespace detail_refwrap {
 
 /**
- * Lazy `InputIterator` implementation for `std::ref`  operation.
- * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Lazy iterator implementation for `std::ref`  operation.
+ * Has the same traversal as the source iterator (up to `RandomAccessIterator`),
+ * when source iterator is a multi-pass one, otherwise is an `InputIterator`.
+ * Supports `CopyConstructible` and `CopyAssignable` only when source iterator does.
  * Wraps elements from source iterator into std::reference_wrapper, 
  * and moves wrappers them out from `operator*` method.
  */
 template<typename Iter, typename Elem>
-class refwrapped_iter {
-    Iter source_iter;
+class refwrapped_iter : public delegated_iter<refwrapped_iter<Iter, Elem>, Iter,
+        typename propagated_iterator_traversal<Iter, true>::type> {
 
 public:
     using value_type = std::reference_wrapper<Elem>;
-    // does not support input_iterator, but valid tag is required
-    // for std::iterator_traits with libc++ on mac
-    using iterator_category = std::input_iterator_tag;
-    using difference_type = std::nullptr_t;
-    using pointer = std::nullptr_t;
-    using reference = std::nullptr_t;
+    using reference = typename std::conditional<
+            std::is_base_of<std::forward_iterator_tag, typename refwrapped_iter::iterator_concept>::value,
+            value_type,
+            std::nullptr_t>::type;
 
     /**
      * Constructor
@@ -58,61 +64,7 @@ public:
      * @param source source iterator
      */
     refwrapped_iter(Iter source_iter) :
-    source_iter(std::move(source_iter)) { }
-    
-    /**
-     * Deleted copy constructor
-     *
-     * @param other other instance
-     */
-    refwrapped_iter(const refwrapped_iter& other) = delete;
-
-    /**
-     * Deleted copy assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    refwrapped_iter& operator=(const refwrapped_iter& other) = delete;
-
-    /**
-     * Move constructor
-     *
-     * @param other other instance
-     */
-    refwrapped_iter(refwrapped_iter&& other) :
-    refwrapped_iter(std::move(other.source_iter)) { }
-
-    /**
-     * Move assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    refwrapped_iter& operator=(refwrapped_iter&& other) {
-        this->source_iter = std::move(other.iter);
-        return *this;
-    }
-
-    /**
-     * Delegated prefix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    refwrapped_iter& operator++() {
-        ++source_iter;
-        return *this;
-    }
-
-    /**
-     * Delegated postfix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    refwrapped_iter& operator++(int) {
-        source_iter++;
-        return *this;
-    }
+    refwrapped_iter::delegated_iter(std::move(source_iter)) { }
 
     /**
      * Clones element from source iterator and returns it.
@@ -120,40 +72,29 @@ public:
      * @return transformed element
      */
     std::reference_wrapper<Elem> operator*() {
-        auto& el = *source_iter;
+        auto& el = *this->source_iter;
         return std::ref(el);
     }
-
-    /**
-     * Delegated operator implementation, does NOT support arbitrary input instances,
-     * should be used only to compare with `past_the_end` iterator.
-     * 
-     * @param end "past the end" iterator
-     * @return whether not both this and specified iterators are "past the end"
-     */
-    bool operator!=(const refwrapped_iter& end) const {
-        return this->source_iter != end.source_iter;
-    }
 };
 
-
 /**
- * Lazy `InputIterator` implementation for `std::cref`  operation.
- * Do not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Lazy iterator implementation for `std::cref`  operation.
+ * Has the same traversal as the source iterator (up to `RandomAccessIterator`),
+ * when source iterator is a multi-pass one, otherwise is an `InputIterator`.
+ * Supports `CopyConstructible` and `CopyAssignable` only when source iterator does.
  * Wraps elements from source iterator into std::reference_wrapper, 
  * and moves wrappers them out from `operator*` method.
  */
 template<typename Iter, typename Elem>
-class refwrapped_const_iter  {
-    Iter source_iter;
+class refwrapped_const_iter : public delegated_iter<refwrapped_const_iter<Iter, Elem>, Iter,
+        typename propagated_iterator_traversal<Iter, true>::type> {
 
 public:
     using value_type = std::reference_wrapper<const Elem>;
-    // do not support input_iterator
-    using iterator_category = std::input_iterator_tag;
-    using difference_type = std::nullptr_t;
-    using pointer = std::nullptr_t;
-    using reference = std::nullptr_t;
+    using reference = typename std::conditional<
+            std::is_base_of<std::forward_iterator_tag, typename refwrapped_const_iter::iterator_concept>::value,
+            value_type,
+            std::nullptr_t>::type;
 
     /**
      * Constructor
@@ -161,61 +102,7 @@ public:
      * @param source source iterator
      */
     refwrapped_const_iter(Iter source_iter) :
-    source_iter(std::move(source_iter)) { }
-    
-    /**
-     * Deleted copy constructor
-     *
-     * @param other other instance
-     */
-    refwrapped_const_iter(const refwrapped_const_iter & other) = delete;
-
-    /**
-     * Deleted copy assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    refwrapped_const_iter& operator=(const refwrapped_const_iter & other) = delete;
-
-    /**
-     * Move constructor
-     *
-     * @param other other instance
-     */
-    refwrapped_const_iter(refwrapped_const_iter && other) :
-    source_iter(std::move(other.source_iter)) { }
-
-    /**
-     * Move assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    refwrapped_const_iter& operator=(refwrapped_const_iter && other) {
-        this->source_iter = std::move(other.source_iter);
-        return *this;
-    }
-
-    /**
-     * Delegated prefix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    refwrapped_const_iter& operator++() {
-        ++source_iter;
-        return *this;
-    }
-
-    /**
-     * Delegated postfix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    refwrapped_const_iter& operator++(int) {
-        source_iter++;
-        return *this;
-    }
+    refwrapped_const_iter::delegated_iter(std::move(source_iter)) { }
 
     /**
      * Clones element from source iterator and returns it.
@@ -223,20 +110,9 @@ public:
      * @return transformed element
      */
     std::reference_wrapper<const Elem> operator*() {
-        const auto& el = *source_iter;
+        const auto& el = *this->source_iter;
         return std::cref(el);
     }
-
-    /**
-     * Delegated operator implementation, do NOT support arbitrary input instances,
-     * should be used only to compare with `past_the_end` iterator.
-     * 
-     * @param end "past the end" iterator
-     * @return whether not both this and specified iterators are "past the end"
-     */
-    bool operator!=(const refwrapped_const_iter & end) const {
-        return this->source_iter != end.source_iter;
-    }
 };
 
 } // namespace
@@ -321,6 +197,68 @@ public:
     detail_refwrap::refwrapped_iter<iterator, value_type_unwrapped> end() {
         return detail_refwrap::refwrapped_iter<iterator, value_type_unwrapped>{std::move(source_range.end())};
     }
+
+    /**
+     * Returns size hint of the source range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range);
+    }
+
+    /**
+     * Pushes all the elements of the source range wrapped with `std::ref`
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        for (auto& el : source_range) {
+            if (!sink(std::ref(el))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Returns the size of the source range,
+     * available only for random-access source ranges
+     *
+     * @return size of the source range
+     */
+    template<typename Iter = iterator,
+            class = typename std::enable_if<is_random_access_iterator<Iter>::value>::type>
+    std::size_t slice_size() const {
+        return static_cast<std::size_t>(std::distance(source_range.begin(), source_range.end()));
+    }
+
+    /**
+     * Pushes the elements with indices `[from, to)` of the source range
+     * wrapped with `std::ref` into the specified sink,
+     * available only for random-access source ranges
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @param from index of the first element
+     * @param to index past the last element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink, typename Iter = iterator,
+            class = typename std::enable_if<is_random_access_iterator<Iter>::value>::type>
+    bool fused_for_each_slice(Sink& sink, std::size_t from, std::size_t to) {
+        using diff_type = typename std::iterator_traits<Iter>::difference_type;
+        auto it = source_range.begin() + static_cast<diff_type>(from);
+        auto end = source_range.begin() + static_cast<diff_type>(to);
+        for (; it != end; ++it) {
+            if (!sink(std::ref(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 
@@ -404,6 +342,68 @@ public:
     detail_refwrap::refwrapped_const_iter<iterator, value_type_unwrapped> end() {
         return detail_refwrap::refwrapped_const_iter<iterator, value_type_unwrapped>{std::move(source_range.end())};
     }
+
+    /**
+     * Returns size hint of the source range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range);
+    }
+
+    /**
+     * Pushes all the elements of the source range wrapped with `std::cref`
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        for (const auto& el : source_range) {
+            if (!sink(std::cref(el))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Returns the size of the source range,
+     * available only for random-access source ranges
+     *
+     * @return size of the source range
+     */
+    template<typename Iter = iterator,
+            class = typename std::enable_if<is_random_access_iterator<Iter>::value>::type>
+    std::size_t slice_size() const {
+        return static_cast<std::size_t>(std::distance(source_range.begin(), source_range.end()));
+    }
+
+    /**
+     * Pushes the elements with indices `[from, to)` of the source range
+     * wrapped with `std::cref` into the specified sink,
+     * available only for random-access source ranges
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @param from index of the first element
+     * @param to index past the last element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink, typename Iter = iterator,
+            class = typename std::enable_if<is_random_access_iterator<Iter>::value>::type>
+    bool fused_for_each_slice(Sink& sink, std::size_t from, std::size_t to) {
+        using diff_type = typename std::iterator_traits<Iter>::difference_type;
+        auto it = source_range.begin() + static_cast<diff_type>(from);
+        auto end = source_range.begin() + static_cast<diff_type>(to);
+        for (; it != end; ++it) {
+            if (!sink(std::cref(*it))) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 
@@ -434,6 +434,67 @@ refwrapped_const_range<Range> refwrap(const Range& range) {
     return refwrapped_const_range<Range>(range);
 }
 
+namespace detail_refwrap {
+
+/**
+ * Adapts an argument of variadic operation to the range type, that will be owned
+ * by the created range wrapper, using the same rules as single-range operations:
+ * temporary ranges are moved, lvalue ranges with `std::reference_wrapper` elements
+ * are moved, other lvalue ranges are wrapped with `refwrap`.
+ * Temporary range case.
+ */
+template<typename Arg, typename = void>
+struct adapted {
+    using type = Arg;
+
+    static type adapt(Arg&& range) {
+        return std::move(range);
+    }
+};
+
+/**
+ * Adapts an argument of variadic operation to the range type,
+ * lvalue range with `std::reference_wrapper` elements case.
+ */
+template<typename Range>
+struct adapted<Range&, typename std::enable_if<
+        is_reference_wrapper<typename Range::value_type>::value && !std::is_const<Range>::value>::type> {
+    using type = Range;
+
+    static type adapt(Range& range) {
+        return std::move(range);
+    }
+};
+
+/**
+ * Adapts an argument of variadic operation to the range type,
+ * lvalue range case.
+ */
+template<typename Range>
+struct adapted<Range&, typename std::enable_if<
+        !is_reference_wrapper<typename Range::value_type>::value && !std::is_const<Range>::value>::type> {
+    using type = refwrapped_range<Range>;
+
+    static type adapt(Range& range) {
+        return staticlib::ranges::refwrap(range);
+    }
+};
+
+/**
+ * Adapts an argument of variadic operation to the range type,
+ * `const` lvalue range case.
+ */
+template<typename Range>
+struct adapted<const Range&, void> {
+    using type = refwrapped_const_range<Range>;
+
+    static type adapt(const Range& range) {
+        return staticlib::ranges::refwrap(range);
+    }
+};
+
+} // namespace
+
 } // namespace
 }
 
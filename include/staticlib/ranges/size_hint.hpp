@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   size_hint.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 10:12 AM
+ */
+
+#ifndef STATICLIB_RANGES_SIZE_HINT_HPP
+#define STATICLIB_RANGES_SIZE_HINT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace staticlib {
+namespace ranges {
+
+/**
+ * Hint about the number of elements that a range will produce,
+ * can be exact, an upper bound or unknown.
+ * Used by eager operations to reserve destination storage up front.
+ */
+class size_hint {
+public:
+    /**
+     * Kind of the hint
+     */
+    enum class kind { UNKNOWN, UPPER_BOUND, EXACT };
+
+private:
+    kind hint_kind;
+    std::size_t hint_value;
+
+    size_hint(kind hint_kind, std::size_t hint_value) :
+    hint_kind(hint_kind),
+    hint_value(hint_value) { }
+
+public:
+    /**
+     * Creates a hint for a range with unknown number of elements
+     *
+     * @return size hint
+     */
+    static size_hint unknown() {
+        return size_hint(kind::UNKNOWN, 0);
+    }
+
+    /**
+     * Creates a hint for a range that will produce no more than
+     * specified number of elements
+     *
+     * @param value upper bound for the number of elements
+     * @return size hint
+     */
+    static size_hint upper_bound(std::size_t value) {
+        return size_hint(kind::UPPER_BOUND, value);
+    }
+
+    /**
+     * Creates a hint for a range that will produce exactly
+     * specified number of elements
+     *
+     * @param value number of elements
+     * @return size hint
+     */
+    static size_hint exact(std::size_t value) {
+        return size_hint(kind::EXACT, value);
+    }
+
+    /**
+     * Accessor for the hint kind
+     *
+     * @return hint kind
+     */
+    kind get_kind() const {
+        return hint_kind;
+    }
+
+    /**
+     * Whether the number of elements is known at least as an upper bound
+     *
+     * @return true if the number of elements is known
+     */
+    bool is_known() const {
+        return kind::UNKNOWN != hint_kind;
+    }
+
+    /**
+     * Whether the number of elements is known exactly
+     *
+     * @return true if the number of elements is exact
+     */
+    bool is_exact() const {
+        return kind::EXACT == hint_kind;
+    }
+
+    /**
+     * Number of elements (exact or upper bound), zero for unknown hint
+     *
+     * @return number of elements
+     */
+    std::size_t value() const {
+        return hint_value;
+    }
+
+    /**
+     * Converts this hint into upper bound one,
+     * used by operations that can drop elements
+     *
+     * @return size hint
+     */
+    size_hint as_upper_bound() const {
+        return is_known() ? upper_bound(hint_value) : unknown();
+    }
+
+    /**
+     * Combines hints of two ranges that are iterated one after another
+     *
+     * @param other hint of the following range
+     * @return size hint
+     */
+    size_hint plus(const size_hint& other) const {
+        if (!this->is_known() || !other.is_known()) {
+            return unknown();
+        }
+        if (this->is_exact() && other.is_exact()) {
+            return exact(this->hint_value + other.hint_value);
+        }
+        return upper_bound(this->hint_value + other.hint_value);
+    }
+};
+
+namespace detail_size_hint {
+
+// dispatch priorities, range's own hint is preferred to the container size
+struct fallback { };
+struct container : fallback { };
+struct own : container { };
+
+template<typename Range>
+auto get(const Range& range, own) -> decltype(range.get_size_hint()) {
+    return range.get_size_hint();
+}
+
+template<typename Range>
+auto get(const Range& range, container) -> decltype(range.size(), size_hint::unknown()) {
+    return size_hint::exact(static_cast<std::size_t>(range.size()));
+}
+
+template<typename Range>
+size_hint get(const Range&, fallback) {
+    return size_hint::unknown();
+}
+
+template<typename Container>
+auto reserve(Container& dest, std::size_t count, container) -> decltype(dest.reserve(count), void()) {
+    auto required = dest.size() + count;
+    if (dest.capacity() < required) {
+        // keep geometric growth for repeated appends into the same container
+        dest.reserve((std::max)(required, dest.capacity() * 2));
+    }
+}
+
+template<typename Container>
+void reserve(Container&, std::size_t, fallback) {
+    // container does not support reservation
+}
+
+// upper bounds (e.g. from selective filters) can be far above the actual size,
+// so only a limited number of elements is reserved for them
+inline std::size_t reserved_count(const size_hint& hint) {
+    const std::size_t upper_bound_limit = 256;
+    return hint.is_exact() || hint.value() < upper_bound_limit ? hint.value() : upper_bound_limit;
+}
+
+} // namespace
+
+/**
+ * Returns size hint for the specified range. Ranges from this library
+ * provide it through `get_size_hint` method, for containers with `size()`
+ * method exact size is returned, for all other ranges hint is unknown.
+ *
+ * @param range input range
+ * @return size hint
+ */
+template<typename Range>
+size_hint get_size_hint(const Range& range) {
+    return detail_size_hint::get(range, detail_size_hint::own());
+}
+
+/**
+ * Reserves space in the specified destination container for the number of
+ * elements specified by hint. For upper bound hints reservation is capped
+ * with a small number of elements, container grows on demand after it.
+ * Does nothing for unknown hints and for containers without `reserve` method.
+ *
+ * @param dest destination container
+ * @param hint size hint of the range that will be appended to container
+ * @return destination container
+ */
+template<typename Container>
+Container& reserve_for(Container& dest, const size_hint& hint) {
+    if (hint.is_known() && hint.value() > 0) {
+        detail_size_hint::reserve(dest, detail_size_hint::reserved_count(hint), detail_size_hint::container());
+    }
+    return dest;
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_SIZE_HINT_HPP */
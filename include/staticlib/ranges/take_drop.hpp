@@ -0,0 +1,904 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   take_drop.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 5:00 PM
+ */
+
+#ifndef STATICLIB_RANGES_TAKE_DROP_HPP
+#define STATICLIB_RANGES_TAKE_DROP_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_take_drop {
+
+template<typename Range>
+using iterator_type = decltype(std::declval<Range&>().begin());
+
+template<typename Range>
+using elem_type = typename std::iterator_traits<iterator_type<Range>>::value_type;
+
+template<typename Range>
+struct is_random_access {
+    static const bool value = is_random_access_iterator<iterator_type<Range>>::value;
+};
+
+/**
+ * Iterators of the lazily started source range, `it` points to the
+ * last element taken from the source and is advanced on the next access
+ */
+template<typename Range>
+struct cursor {
+    iterator_type<Range> it;
+    iterator_type<Range> end;
+
+    void advance() {
+        if (it != end) {
+            ++it;
+        }
+    }
+};
+
+/**
+ * Sink for `take` operation, stops the source after the specified number of elements
+ */
+template<typename Sink>
+class taking_sink {
+    std::size_t* remaining;
+    bool* stopped;
+    Sink* next;
+
+public:
+    taking_sink(std::size_t& remaining, bool& stopped, Sink& next) :
+    remaining(std::addressof(remaining)),
+    stopped(std::addressof(stopped)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        *remaining -= 1;
+        if (!(*next)(std::move(el))) {
+            *stopped = true;
+            return false;
+        }
+        return *remaining > 0;
+    }
+};
+
+/**
+ * Sink for `drop` operation, discards the specified number of first elements
+ */
+template<typename Sink>
+class dropping_sink {
+    std::size_t count;
+    std::size_t* skipped;
+    Sink* next;
+
+public:
+    dropping_sink(std::size_t count, std::size_t& skipped, Sink& next) :
+    count(count),
+    skipped(std::addressof(skipped)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        if (*skipped < count) {
+            *skipped += 1;
+            return true;
+        }
+        return (*next)(std::move(el));
+    }
+};
+
+/**
+ * Sink for `take_while` operation, stops the source on the first element,
+ * that does not match the predicate
+ */
+template<typename Pred, typename Sink>
+class taking_while_sink {
+    Pred* predicate;
+    bool* done;
+    Sink* next;
+
+public:
+    taking_while_sink(Pred& predicate, bool& done, Sink& next) :
+    predicate(std::addressof(predicate)),
+    done(std::addressof(done)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        auto& ref = el;
+        if (!(*predicate)(ref)) {
+            *done = true;
+            return false;
+        }
+        return (*next)(std::move(el));
+    }
+};
+
+/**
+ * Sink for `drop_while` operation, discards first elements while they match the predicate
+ */
+template<typename Pred, typename Sink>
+class dropping_while_sink {
+    Pred* predicate;
+    bool* dropping;
+    Sink* next;
+
+public:
+    dropping_while_sink(Pred& predicate, bool& dropping, Sink& next) :
+    predicate(std::addressof(predicate)),
+    dropping(std::addressof(dropping)),
+    next(std::addressof(next)) { }
+
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        if (*dropping) {
+            auto& ref = el;
+            if ((*predicate)(ref)) {
+                return true;
+            }
+            *dropping = false;
+        }
+        return (*next)(std::move(el));
+    }
+};
+
+} // namespace
+
+/**
+ * Lazy implementation of `take` and `drop` operations over the ranges with
+ * random-access iterators (e.g. vectors and `transform` over vectors):
+ * iterators of the source range are advanced to the bounds of the slice in `O(1)`
+ * and elements outside the slice are never accessed.
+ * Provides random-access iterators and `size()`, so parallel operations
+ * (see `parallel_policy`) can be applied to the slice.
+ */
+template<typename Range>
+class sliced_range {
+    using source_iterator = detail_take_drop::iterator_type<Range>;
+    using diff_type = typename std::iterator_traits<source_iterator>::difference_type;
+
+    Range source_range;
+    std::size_t from;
+    std::size_t to;
+
+public:
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = detail_take_drop::elem_type<Range>;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = source_iterator;
+
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * Bounds of the slice are clamped to the size of the source range once,
+     * on construction.
+     *
+     * @param source_range source range
+     * @param from index of the first element of the slice
+     * @param to index past the last element of the slice
+     */
+    sliced_range(Range&& source_range, std::size_t from, std::size_t to) :
+    source_range(std::move(source_range)) {
+        auto total = static_cast<std::size_t>(this->source_range.end() - this->source_range.begin());
+        this->from = from < total ? from : total;
+        this->to = to < total ? (to > this->from ? to : this->from) : total;
+    }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    sliced_range(const sliced_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    sliced_range& operator=(const sliced_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    sliced_range(sliced_range&& other) :
+    source_range(std::move(other.source_range)),
+    from(other.from),
+    to(other.to) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    sliced_range& operator=(sliced_range&& other) = delete;
+
+    /**
+     * Returns `begin` iterator, source `begin` iterator advanced to the start of the slice
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        return source_range.begin() + static_cast<diff_type>(from);
+    }
+
+    /**
+     * Returns `past_the_end` iterator, source `begin` iterator advanced to the end of the slice
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return source_range.begin() + static_cast<diff_type>(to);
+    }
+
+    /**
+     * Number of elements in the slice
+     *
+     * @return number of elements
+     */
+    std::size_t size() const {
+        return to - from;
+    }
+
+    /**
+     * Returns exact size hint of this range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return size_hint::exact(size());
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `take` operation over
+ * the ranges without random-access iterators.
+ * After the specified number of elements is returned, source range is not accessed anymore,
+ * so no upstream work (e.g. `range_adapter::compute_next()` call) is done
+ * for the elements that are not needed.
+ */
+template<typename Range>
+class taken_range : public range_adapter<taken_range<Range>, detail_take_drop::elem_type<Range>> {
+    using elem_type = detail_take_drop::elem_type<Range>;
+
+    Range source_range;
+    std::size_t count;
+    std::size_t taken = 0;
+    std::unique_ptr<detail_take_drop::cursor<Range>> cur;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param count max number of elements to take
+     */
+    taken_range(Range&& source_range, std::size_t count) :
+    source_range(std::move(source_range)),
+    count(count) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    taken_range(const taken_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    taken_range& operator=(const taken_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    taken_range(taken_range&& other) :
+    range_adapter<taken_range<Range>, elem_type>(std::move(other)),
+    source_range(std::move(other.source_range)),
+    count(other.count),
+    taken(other.taken),
+    cur(std::move(other.cur)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    taken_range& operator=(taken_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range limited with the number of elements to take
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        auto hint = staticlib::ranges::get_size_hint(source_range);
+        if (!hint.is_known()) {
+            return size_hint::upper_bound(count);
+        }
+        if (hint.value() > count) {
+            return hint.is_exact() ? size_hint::exact(count) : size_hint::upper_bound(count);
+        }
+        return hint;
+    }
+
+    /**
+     * Takes next element from the source range, source range is not accessed
+     * after the specified number of elements is taken
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        if (taken >= count) {
+            return false;
+        }
+        // source is advanced lazily, so the last taken element is the last computed one
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new detail_take_drop::cursor<Range>{std::move(source_range.begin()), std::move(source_range.end())});
+        } else {
+            cur->advance();
+        }
+        if (!(cur->it != cur->end)) {
+            return false;
+        }
+        this->taken += 1;
+        return this->set_current(std::move(*cur->it));
+    }
+
+    /**
+     * Pushes no more than the specified number of the remaining elements
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        if (cur) {
+            while (taken < count) {
+                cur->advance();
+                if (!(cur->it != cur->end)) {
+                    return true;
+                }
+                this->taken += 1;
+                if (!sink(std::move(*cur->it))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        std::size_t remaining = count - taken;
+        if (0 == remaining) {
+            return true;
+        }
+        bool stopped = false;
+        auto stage = detail_take_drop::taking_sink<Sink>(remaining, stopped, sink);
+        staticlib::ranges::fused_for_each(source_range, stage);
+        this->taken = count - remaining;
+        return !stopped;
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `drop` operation over
+ * the ranges without random-access iterators, the specified number of first elements
+ * of the source range is discarded.
+ */
+template<typename Range>
+class dropped_range : public range_adapter<dropped_range<Range>, detail_take_drop::elem_type<Range>> {
+    using elem_type = detail_take_drop::elem_type<Range>;
+
+    Range source_range;
+    std::size_t count;
+    std::size_t skipped = 0;
+    std::unique_ptr<detail_take_drop::cursor<Range>> cur;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param count number of elements to drop
+     */
+    dropped_range(Range&& source_range, std::size_t count) :
+    source_range(std::move(source_range)),
+    count(count) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    dropped_range(const dropped_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    dropped_range& operator=(const dropped_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    dropped_range(dropped_range&& other) :
+    range_adapter<dropped_range<Range>, elem_type>(std::move(other)),
+    source_range(std::move(other.source_range)),
+    count(other.count),
+    skipped(other.skipped),
+    cur(std::move(other.cur)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    dropped_range& operator=(dropped_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range reduced by the number of elements to drop
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        auto hint = staticlib::ranges::get_size_hint(source_range);
+        if (!hint.is_known()) {
+            return hint;
+        }
+        std::size_t value = hint.value() > count ? hint.value() - count : 0;
+        return hint.is_exact() ? size_hint::exact(value) : size_hint::upper_bound(value);
+    }
+
+    /**
+     * Takes next element from the source range, skips
+     * the specified number of elements on the first call
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new detail_take_drop::cursor<Range>{std::move(source_range.begin()), std::move(source_range.end())});
+            for (; skipped < count && cur->it != cur->end; skipped++) {
+                ++cur->it;
+            }
+        } else {
+            cur->advance();
+        }
+        if (!(cur->it != cur->end)) {
+            return false;
+        }
+        return this->set_current(std::move(*cur->it));
+    }
+
+    /**
+     * Pushes remaining elements after the dropped ones
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        if (cur) {
+            for (cur->advance(); cur->it != cur->end; ++cur->it) {
+                if (!sink(std::move(*cur->it))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        auto stage = detail_take_drop::dropping_sink<Sink>(count, skipped, sink);
+        return staticlib::ranges::fused_for_each(source_range, stage);
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `take_while` operation,
+ * elements are returned while they match the specified predicate.
+ * First element, that does not match the predicate, is discarded and
+ * source range is not accessed after it.
+ */
+template<typename Range, typename Pred>
+class taken_while_range : public range_adapter<taken_while_range<Range, Pred>,
+        detail_take_drop::elem_type<Range>> {
+    using elem_type = detail_take_drop::elem_type<Range>;
+
+    Range source_range;
+    Pred predicate;
+    bool done = false;
+    std::unique_ptr<detail_take_drop::cursor<Range>> cur;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param predicate `Predicate` to check source elements against it
+     */
+    taken_while_range(Range&& source_range, Pred predicate) :
+    source_range(std::move(source_range)),
+    predicate(std::move(predicate)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    taken_while_range(const taken_while_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    taken_while_range& operator=(const taken_while_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    taken_while_range(taken_while_range&& other) :
+    range_adapter<taken_while_range<Range, Pred>, elem_type>(std::move(other)),
+    source_range(std::move(other.source_range)),
+    predicate(std::move(other.predicate)),
+    done(other.done),
+    cur(std::move(other.cur)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    taken_while_range& operator=(taken_while_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range as an upper bound
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range).as_upper_bound();
+    }
+
+    /**
+     * Takes next element from the source range and checks it against the predicate
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        if (done) {
+            return false;
+        }
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new detail_take_drop::cursor<Range>{std::move(source_range.begin()), std::move(source_range.end())});
+        } else {
+            cur->advance();
+        }
+        if (cur->it != cur->end) {
+            elem_type el = std::move(*cur->it);
+            if (predicate(el)) {
+                return this->set_current(std::move(el));
+            }
+        }
+        this->done = true;
+        return false;
+    }
+
+    /**
+     * Pushes remaining elements into the specified sink while
+     * they match the predicate, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        if (done) {
+            return true;
+        }
+        if (cur) {
+            for (cur->advance(); cur->it != cur->end; ++cur->it) {
+                elem_type el = std::move(*cur->it);
+                if (!predicate(el)) {
+                    this->done = true;
+                    return true;
+                }
+                if (!sink(std::move(el))) {
+                    return false;
+                }
+            }
+            this->done = true;
+            return true;
+        }
+        auto stage = detail_take_drop::taking_while_sink<Pred, Sink>(predicate, done, sink);
+        bool res = staticlib::ranges::fused_for_each(source_range, stage);
+        return res || done;
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `drop_while` operation,
+ * first elements of the source range are discarded while they match
+ * the specified predicate, all the following elements are returned.
+ */
+template<typename Range, typename Pred>
+class dropped_while_range : public range_adapter<dropped_while_range<Range, Pred>,
+        detail_take_drop::elem_type<Range>> {
+    using elem_type = detail_take_drop::elem_type<Range>;
+
+    Range source_range;
+    Pred predicate;
+    bool dropping = true;
+    std::unique_ptr<detail_take_drop::cursor<Range>> cur;
+
+public:
+    /**
+     * Constructor,
+     * created range wrapper will own specified range
+     *
+     * @param source_range source range
+     * @param predicate `Predicate` to check source elements against it
+     */
+    dropped_while_range(Range&& source_range, Pred predicate) :
+    source_range(std::move(source_range)),
+    predicate(std::move(predicate)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    dropped_while_range(const dropped_while_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    dropped_while_range& operator=(const dropped_while_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    dropped_while_range(dropped_while_range&& other) :
+    range_adapter<dropped_while_range<Range, Pred>, elem_type>(std::move(other)),
+    source_range(std::move(other.source_range)),
+    predicate(std::move(other.predicate)),
+    dropping(other.dropping),
+    cur(std::move(other.cur)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    dropped_while_range& operator=(dropped_while_range&& other) = delete;
+
+    /**
+     * Returns size hint of the source range as an upper bound
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range).as_upper_bound();
+    }
+
+    /**
+     * Takes next element from the source range, skips first
+     * elements matching the predicate on the first call
+     *
+     * @return true if next element exists, false (range exhausted) otherwise
+     */
+    bool compute_next() {
+        if (!cur) {
+            // move here is required by msvs
+            cur.reset(new detail_take_drop::cursor<Range>{std::move(source_range.begin()), std::move(source_range.end())});
+        } else {
+            cur->advance();
+        }
+        for (; cur->it != cur->end; ++cur->it) {
+            elem_type el = std::move(*cur->it);
+            if (!dropping || !predicate(el)) {
+                this->dropping = false;
+                return this->set_current(std::move(el));
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Pushes remaining elements after the dropped ones
+     * into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        if (cur) {
+            for (cur->advance(); cur->it != cur->end; ++cur->it) {
+                elem_type el = std::move(*cur->it);
+                if (!dropping || !predicate(el)) {
+                    this->dropping = false;
+                    if (!sink(std::move(el))) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        auto stage = detail_take_drop::dropping_while_sink<Pred, Sink>(predicate, dropping, sink);
+        return staticlib::ranges::fused_for_each(source_range, stage);
+    }
+};
+
+namespace detail_take_drop {
+
+template<typename Range>
+using take_type = typename std::conditional<is_random_access<Range>::value,
+        sliced_range<Range>, taken_range<Range>>::type;
+
+template<typename Range>
+using drop_type = typename std::conditional<is_random_access<Range>::value,
+        sliced_range<Range>, dropped_range<Range>>::type;
+
+template<typename Range>
+sliced_range<Range> take(Range&& range, std::size_t count, std::true_type) {
+    return sliced_range<Range>(std::move(range), 0, count);
+}
+
+template<typename Range>
+taken_range<Range> take(Range&& range, std::size_t count, std::false_type) {
+    return taken_range<Range>(std::move(range), count);
+}
+
+template<typename Range>
+sliced_range<Range> drop(Range&& range, std::size_t count, std::true_type) {
+    return sliced_range<Range>(std::move(range), count, static_cast<std::size_t>(-1));
+}
+
+template<typename Range>
+dropped_range<Range> drop(Range&& range, std::size_t count, std::false_type) {
+    return dropped_range<Range>(std::move(range), count);
+}
+
+} // namespace
+
+/**
+ * Lazily takes no more than the specified number of first elements of the input range.
+ * Ranges with random-access iterators are sliced in `O(1)` (see `sliced_range`),
+ * for other ranges source is not accessed after the last needed element (see `taken_range`).
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @param count max number of elements to take
+ * @return range of first elements
+ */
+template<typename Range>
+detail_take_drop::take_type<typename detail_refwrap::adapted<Range>::type> take(Range&& range, std::size_t count) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    return detail_take_drop::take(detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)), count,
+            std::integral_constant<bool, detail_take_drop::is_random_access<range_type>::value>());
+}
+
+/**
+ * Lazily discards the specified number of first elements of the input range.
+ * Ranges with random-access iterators are sliced in `O(1)` without accessing
+ * dropped elements (see `sliced_range`), for other ranges dropped elements are
+ * iterated over and discarded (see `dropped_range`).
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @param count number of elements to drop
+ * @return range of remaining elements
+ */
+template<typename Range>
+detail_take_drop::drop_type<typename detail_refwrap::adapted<Range>::type> drop(Range&& range, std::size_t count) {
+    using range_type = typename detail_refwrap::adapted<Range>::type;
+    return detail_take_drop::drop(detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)), count,
+            std::integral_constant<bool, detail_take_drop::is_random_access<range_type>::value>());
+}
+
+/**
+ * Lazily takes first elements of the input range while they match
+ * the specified predicate, see `taken_while_range`.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @param predicate `Predicate` to check source elements against it
+ * @return range of first matching elements
+ */
+template<typename Range, typename Pred>
+taken_while_range<typename detail_refwrap::adapted<Range>::type, Pred> take_while(Range&& range, Pred predicate) {
+    return taken_while_range<typename detail_refwrap::adapted<Range>::type, Pred>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)), std::move(predicate));
+}
+
+/**
+ * Lazily discards first elements of the input range while they match
+ * the specified predicate, see `dropped_while_range`.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @param predicate `Predicate` to check source elements against it
+ * @return range of remaining elements
+ */
+template<typename Range, typename Pred>
+dropped_while_range<typename detail_refwrap::adapted<Range>::type, Pred> drop_while(Range&& range, Pred predicate) {
+    return dropped_while_range<typename detail_refwrap::adapted<Range>::type, Pred>(
+            detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)), std::move(predicate));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_TAKE_DROP_HPP */
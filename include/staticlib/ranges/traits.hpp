@@ -24,7 +24,22 @@
 #ifndef STATICLIB_RANGES_TRAITS_HPP
 #define STATICLIB_RANGES_TRAITS_HPP
 
+#include <array>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// polymorphic allocators support
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#define STATICLIB_RANGES_PMR
+#include <memory_resource>
+#endif
+#endif
 
 namespace staticlib {
 namespace ranges {
@@ -45,6 +60,149 @@ struct is_reference_wrapper<std::reference_wrapper<T>> {
     static const bool value = true;
 };
 
+namespace detail_traits {
+
+template<typename Iter>
+auto check_iterator_concept(int) -> typename Iter::iterator_concept;
+
+template<typename Iter>
+auto check_iterator_concept(...) -> typename std::iterator_traits<Iter>::iterator_category;
+
+} // namespace
+
+/**
+ * Type trait to compute the traversal supported by the specified iterator:
+ * `iterator_concept` member (lazy iterators, that return elements by value,
+ * report only `std::input_iterator_tag` as their `iterator_category`)
+ * or `iterator_category` of the iterator when it has no such member
+ */
+template<typename Iter>
+struct iterator_traversal {
+    using type = decltype(detail_traits::check_iterator_concept<typename std::decay<Iter>::type>(0));
+};
+
+/**
+ * Type trait to detect iterators that support `RandomAccessIterator` operations
+ */
+template<typename Iter>
+struct is_random_access_iterator {
+    static const bool value = std::is_base_of<std::random_access_iterator_tag,
+            typename iterator_traversal<Iter>::type>::value;
+};
+
+/**
+ * Type trait to compute the traversal of lazy iterator, that wraps
+ * specified source iterator. Source traversal (clamped to `std::random_access_iterator_tag`)
+ * is propagated for multi-pass (`ForwardIterator` and better) source iterators when
+ * `Propagate` is true, `std::input_iterator_tag` is used otherwise.
+ */
+template<typename Iter, bool Propagate = true>
+struct propagated_iterator_traversal {
+private:
+    using source_traversal = typename iterator_traversal<Iter>::type;
+
+public:
+    using type = typename std::conditional<
+            !Propagate || !std::is_base_of<std::forward_iterator_tag, source_traversal>::value,
+            std::input_iterator_tag,
+            typename std::conditional<
+                std::is_base_of<std::random_access_iterator_tag, source_traversal>::value,
+                std::random_access_iterator_tag,
+                typename std::conditional<
+                    std::is_base_of<std::bidirectional_iterator_tag, source_traversal>::value,
+                    std::bidirectional_iterator_tag,
+                    std::forward_iterator_tag
+                >::type
+            >::type
+        >::type;
+};
+
+/**
+ * Type trait to detect containers that store elements contiguously
+ * and provide access to them through `data()` method, negative case
+ */
+template<typename T>
+struct is_contiguous_container {
+    static const bool value = false;
+};
+
+/**
+ * Type trait to detect containers that store elements contiguously
+ * and provide access to them through `data()` method, `std::vector` case,
+ * `std::vector<bool>` is not contiguous
+ */
+template<typename T, typename Alloc>
+struct is_contiguous_container<std::vector<T, Alloc>> {
+    static const bool value = !std::is_same<T, bool>::value;
+};
+
+/**
+ * Type trait to detect containers that store elements contiguously
+ * and provide access to them through `data()` method, `std::array` case
+ */
+template<typename T, std::size_t N>
+struct is_contiguous_container<std::array<T, N>> {
+    static const bool value = true;
+};
+
+/**
+ * Type trait to detect containers that store elements contiguously
+ * and provide access to them through `data()` method, `std::basic_string` case
+ */
+template<typename CharT, typename Traits, typename Alloc>
+struct is_contiguous_container<std::basic_string<CharT, Traits, Alloc>> {
+    static const bool value = true;
+};
+
+namespace detail_traits {
+
+template<typename T>
+auto check_allocator(int) -> decltype(std::declval<T&>().allocate(std::size_t(1)), std::true_type());
+
+template<typename T>
+std::false_type check_allocator(...);
+
+} // namespace
+
+/**
+ * Type trait to detect `Allocator` types
+ */
+template<typename T>
+struct is_allocator {
+    static const bool value = std::is_same<decltype(detail_traits::check_allocator<T>(0)), std::true_type>::value;
+};
+
+/**
+ * Type of the vector with elements of the specified type, that uses
+ * specified allocator (rebound to the element type)
+ */
+template<typename T, typename Alloc>
+struct allocated_vector {
+    using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using type = std::vector<T, allocator_type>;
+};
+
+/**
+ * Compile-time sequence of indices, replacement for
+ * C++14 `std::index_sequence`
+ */
+template<std::size_t... Indices>
+struct index_sequence { };
+
+/**
+ * Creates `index_sequence` with indices `[0, N)`, replacement for
+ * C++14 `std::make_index_sequence`
+ */
+template<std::size_t N, std::size_t... Indices>
+struct make_index_sequence : make_index_sequence<N - 1, N - 1, Indices...> { };
+
+/**
+ * Creates `index_sequence` with indices `[0, N)`, replacement for
+ * C++14 `std::make_index_sequence`, terminal case
+ */
+template<std::size_t... Indices>
+struct make_index_sequence<0, Indices...> : index_sequence<Indices...> { };
+
 } // namespace
 }
 
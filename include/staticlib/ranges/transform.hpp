@@ -24,13 +24,18 @@
 #ifndef STATICLIB_RANGES_TRANSFORM_HPP
 #define STATICLIB_RANGES_TRANSFORM_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "staticlib/ranges/delegated_iter.hpp"
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/parallel.hpp"
 #include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
 #include "staticlib/ranges/traits.hpp"
 
 namespace staticlib {
@@ -39,24 +44,36 @@ namespace ranges {
 namespace detail_transform {
 
 /**
- * Lazy `InputIterator` implementation for `transform`  operation.
- * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Type trait to detect source iterators, whose elements are not modified
+ * by moving them into the functor, so they can be accessed multiple times
+ */
+template<typename Iter>
+struct is_multi_access {
+    using element_type = typename std::decay<decltype(*std::declval<Iter&>())>::type;
+    static const bool value = is_reference_wrapper<element_type>::value ||
+            std::is_scalar<element_type>::value;
+};
+
+/**
+ * Lazy iterator implementation for `transform`  operation.
+ * Has the same traversal as the source iterator (up to `RandomAccessIterator`),
+ * when source iterator is a multi-pass one and its elements are `std::reference_wrapper`
+ * instances or scalars, otherwise is an `InputIterator`.
+ * Supports `CopyConstructible` and `CopyAssignable` only when source iterator does.
  * Moves element from source iterator, applies `FunctionObject` (usually lambda) 
  * to it and moves it out from `operator*` method.
  */
 template<typename Iter, typename Elem, typename Func>
-class transformed_iter {
-    Iter source_iter;
+class transformed_iter : public delegated_iter<transformed_iter<Iter, Elem, Func>, Iter,
+        typename propagated_iterator_traversal<Iter, is_multi_access<Iter>::value>::type> {
     Func* functor;
 
 public:
     using value_type = Elem;
-    // does not support input_iterator, but valid tag is required
-    // for std::iterator_traits with libc++ on mac
-    using iterator_category = std::input_iterator_tag;
-    using difference_type = std::nullptr_t;
-    using pointer = std::nullptr_t;
-    using reference = std::nullptr_t;
+    using reference = typename std::conditional<
+            std::is_base_of<std::forward_iterator_tag, typename transformed_iter::iterator_concept>::value,
+            value_type,
+            std::nullptr_t>::type;
 
     /**
      * Constructor
@@ -65,64 +82,8 @@ public:
      * @param functor `FunctionObject` to apply to returned values
      */
     transformed_iter(Iter source_iter, Func& functor) :
-    source_iter(std::move(source_iter)),
+    transformed_iter::delegated_iter(std::move(source_iter)),
     functor(std::addressof(functor)) { }
-    
-    /**
-     * Deleted copy constructor
-     *
-     * @param other other instance
-     */
-    transformed_iter(const transformed_iter& other) = delete;
-
-    /**
-     * Deleted copy assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    transformed_iter& operator=(const transformed_iter& other) = delete;
-
-    /**
-     * Move constructor
-     *
-     * @param other other instance
-     */
-    transformed_iter(transformed_iter&& other) : 
-    source_iter(std::move(other.source_iter)), 
-    functor(std::move(other.functor)) { }
-
-    /**
-     * Move assignment operator
-     *
-     * @param other other instance
-     * @return reference to this instance
-     */
-    transformed_iter& operator=(transformed_iter&& other) {
-        this->source_iter = std::move(other.source_iter);
-        this->functor = std::move(other.functor);
-        return *this;
-    }
-
-    /**
-     * Delegated prefix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    transformed_iter& operator++() {
-        ++source_iter;
-        return *this;
-    }
-
-    /**
-     * Delegated postfix operator implementation
-     * 
-     * @return reference to iter instance
-     */
-    transformed_iter& operator++(int) {
-        source_iter++;
-        return *this;
-    }
 
     /**
      * Moves element from source iterator, applies functor (usually lambda) 
@@ -131,18 +92,41 @@ public:
      * @return transformed element
      */
     Elem operator*() {
-        return (*functor)(std::move(*source_iter));
+        return (*functor)(std::move(*this->source_iter));
     }
+};
+
+
+/**
+ * Sink that applies `FunctionObject` to each element and pushes
+ * results to the next sink.
+ */
+template<typename Func, typename Sink>
+class transforming_sink {
+    Func* functor;
+    Sink* next;
 
+public:
     /**
-     * Delegated operator implementation, does NOT support arbitrary input instances,
-     * should be used only to compare with `past_the_end` iterator.
-     * 
-     * @param end "past the end" iterator
-     * @return whether not both this and specified iterators are "past the end"
+     * Constructor
+     *
+     * @param functor `FunctionObject` to apply to elements
+     * @param next next sink
+     */
+    transforming_sink(Func& functor, Sink& next) :
+    functor(std::addressof(functor)),
+    next(std::addressof(next)) { }
+
+    /**
+     * Applies functor to the specified element and pushes result
+     * to the next sink
+     *
+     * @param el element
+     * @return false if iteration was stopped by sink, true otherwise
      */
-    bool operator!=(const transformed_iter& end) const {
-        return this->source_iter != end.source_iter;
+    template<typename Elem>
+    bool operator()(Elem&& el) {
+        return (*next)((*functor)(std::move(el)));
     }
 };
 
@@ -237,6 +221,58 @@ public:
         return detail_transform::transformed_iter<source_iterator, value_type, Func>{std::move(source_range.end()), functor};
     }
     
+    /**
+     * Returns size hint of this range, it is the same as
+     * the size hint of the source range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return staticlib::ranges::get_size_hint(source_range);
+    }
+
+    /**
+     * Pushes all the elements of the source range through transformation
+     * functor into the specified sink, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        auto stage = detail_transform::transforming_sink<Func, Sink>(functor, sink);
+        return staticlib::ranges::fused_for_each(source_range, stage);
+    }
+
+    /**
+     * Returns the size of the innermost random-access source range,
+     * available only for sliceable source ranges
+     *
+     * @return size of the innermost source range
+     */
+    template<typename R = Range,
+            class = typename std::enable_if<detail_fusion::is_sliceable<R>::value>::type>
+    std::size_t slice_size() const {
+        return detail_fusion::get_slice_size(source_range);
+    }
+
+    /**
+     * Pushes elements, produced from the elements of the innermost random-access
+     * source range with indices `[from, to)`, through transformation functor into the specified sink,
+     * available only for sliceable source ranges
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @param from index of the first source element
+     * @param to index past the last source element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink, typename R = Range,
+            class = typename std::enable_if<detail_fusion::is_sliceable<R>::value>::type>
+    bool fused_for_each_slice(Sink& sink, std::size_t from, std::size_t to) {
+        auto stage = detail_transform::transforming_sink<Func, Sink>(functor, sink);
+        return detail_fusion::fused_for_each_slice(source_range, stage, from, to);
+    }
+
     /**
      * Process this range eagerly returning results as 
      * a newly-allocated vector.
@@ -244,11 +280,50 @@ public:
      * @return vector with processed elements
      */
     std::vector<value_type> to_vector() {
-        std::vector<value_type> vec;
-        for (auto&& el : *this) {
-            vec.emplace_back(std::move(el));
-        }
-        return vec;
+        return detail_fusion::collect(*this, std::vector<value_type>());
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        return detail_fusion::collect_allocated<value_type>(*this, alloc);
+    }
+
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
+
+    /**
+     * Process this range eagerly using multiple threads returning results
+     * as a newly-allocated vector, order of the elements is preserved.
+     * Only ranges over random-access sources are processed in parallel,
+     * all other ranges are processed sequentially, see `parallel_policy`.
+     * Results are written straight into the pre-sized vector when element type
+     * is `DefaultConstructible` and `MoveAssignable`.
+     *
+     * @param policy parallel execution policy
+     * @return vector with processed elements
+     */
+    std::vector<value_type> to_vector(const parallel_policy& policy) {
+        return detail_parallel::to_vector<value_type>(*this, policy,
+                std::integral_constant<bool, detail_fusion::is_sliceable<Range>::value>());
     }
 };
 
@@ -0,0 +1,444 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   transform_batch.hpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 5:40 PM
+ */
+
+#ifndef STATICLIB_RANGES_TRANSFORM_BATCH_HPP
+#define STATICLIB_RANGES_TRANSFORM_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/batch_kernels.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_batch {
+
+/**
+ * Lazy `InputIterator` implementation for `transform_batch` operation.
+ * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Holds a pointer to the parent range and returns elements from its
+ * block buffer.
+ */
+template<typename Range>
+class batch_transformed_iter {
+    Range* range;
+
+public:
+    using value_type = typename Range::value_type;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param range parent range, `nullptr` for "past the end" iterator
+     */
+    batch_transformed_iter(Range* range) :
+    range(range) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    batch_transformed_iter(const batch_transformed_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_transformed_iter& operator=(const batch_transformed_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    batch_transformed_iter(batch_transformed_iter&& other) :
+    range(other.range) {
+        other.range = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_transformed_iter& operator=(batch_transformed_iter&& other) {
+        this->range = other.range;
+        other.range = nullptr;
+        return *this;
+    }
+
+    /**
+     * Iterates to the next element, processes the next block
+     * of source elements when the current one is exhausted
+     *
+     * @return reference to iter instance
+     */
+    batch_transformed_iter& operator++() {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Iterates to the next element, processes the next block
+     * of source elements when the current one is exhausted
+     *
+     * @return reference to iter instance
+     */
+    batch_transformed_iter& operator++(int) {
+        if (range) {
+            range->next_element();
+        }
+        return *this;
+    }
+
+    /**
+     * Returns current transformed element
+     *
+     * @return current element
+     */
+    value_type operator*() {
+        if (range) {
+            return range->current_element();
+        } else {
+            throw std::range_error("Invalid attempt to dereference a 'past_the_end' iterator");
+        }
+    }
+
+    /**
+     * Compares this iterator instance with a "past the end"
+     * Does NOT support arbitrary input instances,
+     * should be used only to compare with "past the end" iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const batch_transformed_iter& end) const {
+        return (this->range && !this->range->exhausted()) ||
+                (end.range && !end.range->exhausted());
+    }
+};
+
+template<typename Out, typename In>
+struct output_type {
+    using type = Out;
+};
+
+template<typename In>
+struct output_type<void, In> {
+    using type = In;
+};
+
+} // namespace
+
+/**
+ * Lazy implementation of `SinglePassRange` for `transform_batch` operation.
+ * Kernel is applied to the contiguous blocks of source elements,
+ * `to_vector` applies it to the whole source container at once.
+ * Source container is owned when `Holder` is not a reference.
+ */
+template<typename Holder, typename Out, typename Kernel>
+class batch_transformed_range {
+    friend class detail_batch::batch_transformed_iter<batch_transformed_range>;
+
+    Holder source_range;
+    Kernel kernel;
+    std::size_t block_size;
+    std::vector<Out> buffer;
+    std::size_t offset = 0;
+    std::size_t buffer_len = 0;
+    std::size_t pos = 0;
+
+public:
+    static_assert(!std::is_same<Out, bool>::value, "'bool' output elements are not supported");
+
+    /**
+     * Type of the elements of the source container, can be const
+     */
+    using element_type = typename std::remove_pointer<
+            decltype(std::declval<typename std::remove_reference<Holder>::type&>().data())>::type;
+
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = Out;
+
+    /**
+     * Result iterator type
+     */
+    using iterator = detail_batch::batch_transformed_iter<batch_transformed_range>;
+
+    /**
+     * Constructor
+     *
+     * @param source_range source container
+     * @param kernel batch `FunctionObject` with signature `void(const In*, size_t, Out*)`
+     * @param block_size number of elements to process with a single kernel call
+     */
+    batch_transformed_range(Holder&& source_range, Kernel kernel, std::size_t block_size) :
+    source_range(std::forward<Holder>(source_range)),
+    kernel(std::move(kernel)),
+    block_size(block_size > 0 ? block_size : 1) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    batch_transformed_range(const batch_transformed_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_transformed_range& operator=(const batch_transformed_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    batch_transformed_range(batch_transformed_range&& other) :
+    source_range(std::forward<Holder>(other.source_range)),
+    kernel(std::move(other.kernel)),
+    block_size(other.block_size),
+    buffer(std::move(other.buffer)),
+    offset(other.offset),
+    buffer_len(other.buffer_len),
+    pos(other.pos) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    batch_transformed_range& operator=(batch_transformed_range&& other) = delete;
+
+    /**
+     * Returns `begin` iterator, processes the first block
+     *
+     * @return `begin` iterator
+     */
+    iterator begin() {
+        offset = 0;
+        buffer_len = 0;
+        fill_buffer();
+        return iterator(this);
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    /**
+     * Returns exact size hint, it is the size of the source container
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return size_hint::exact(source_range.size());
+    }
+
+    /**
+     * Pushes all the transformed elements into the specified sink processing
+     * source container block by block, see `fused_for_each`
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink>
+    bool fused_for_each(Sink& sink) {
+        offset = 0;
+        buffer_len = 0;
+        fill_buffer();
+        while (!exhausted()) {
+            for (std::size_t i = 0; i < buffer_len; i++) {
+                if (!sink(std::move(buffer[i]))) {
+                    return false;
+                }
+            }
+            offset += buffer_len;
+            fill_buffer();
+        }
+        return true;
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector. Kernel is called once for
+     * the whole source container.
+     *
+     * @return vector with processed elements
+     */
+    std::vector<value_type> to_vector() {
+        return apply_kernel(std::vector<value_type>(source_range.size()));
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage. Kernel is called once for
+     * the whole source container.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        using vector_type = typename allocated_vector<value_type, Alloc>::type;
+        return apply_kernel(vector_type(source_range.size(), value_type(),
+                typename vector_type::allocator_type(alloc)));
+    }
+
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     * Kernel is called once for the whole source container.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
+
+private:
+    bool exhausted() const {
+        return pos >= buffer_len;
+    }
+
+    value_type current_element() {
+        return std::move(buffer[pos]);
+    }
+
+    void next_element() {
+        pos += 1;
+        if (pos >= buffer_len) {
+            offset += buffer_len;
+            fill_buffer();
+        }
+    }
+
+    void fill_buffer() {
+        std::size_t size = source_range.size();
+        buffer_len = offset < size ? (std::min)(block_size, size - offset) : 0;
+        pos = 0;
+        if (buffer_len > 0) {
+            buffer.resize(block_size);
+            kernel(source_range.data() + offset, buffer_len, buffer.data());
+        }
+    }
+
+    template<typename Vector>
+    Vector apply_kernel(Vector vec) {
+        if (vec.size() > 0) {
+            kernel(source_range.data(), vec.size(), vec.data());
+        }
+        return vec;
+    }
+};
+
+/**
+ * Lazily transforms contiguous container (`std::vector`, `std::array`, `std::basic_string`)
+ * of arithmetic elements applying batch kernel to the contiguous blocks of elements.
+ * Kernel is a `FunctionObject` with signature `void(const In* in, size_t n, Out* out)`,
+ * see `batch_add` and `batch_multiply` for vectorized kernels.
+ * Output element type is the same as input one, unless specified explicitly.
+ * Source container is not modified.
+ * Created range wrapper will own specified container.
+ *
+ * @param range source container
+ * @param kernel batch `FunctionObject`
+ * @param block_size number of elements to process with a single kernel call during iteration
+ * @return transformed range
+ */
+template<typename Out = void, typename Range, typename Kernel,
+        class = typename std::enable_if<!std::is_lvalue_reference<Range>::value &&
+                is_contiguous_container<typename std::decay<Range>::type>::value>::type>
+batch_transformed_range<Range,
+        typename detail_batch::output_type<Out, typename std::decay<Range>::type::value_type>::type, Kernel>
+transform_batch(Range&& range, Kernel kernel, std::size_t block_size = 1024) {
+    return batch_transformed_range<Range,
+            typename detail_batch::output_type<Out, typename std::decay<Range>::type::value_type>::type, Kernel>(
+            std::move(range), std::move(kernel), block_size);
+}
+
+/**
+ * Lazily transforms contiguous container (`std::vector`, `std::array`, `std::basic_string`)
+ * of arithmetic elements applying batch kernel to the contiguous blocks of elements.
+ * Kernel is a `FunctionObject` with signature `void(const In* in, size_t n, Out* out)`,
+ * see `batch_add` and `batch_multiply` for vectorized kernels.
+ * Output element type is the same as input one, unless specified explicitly.
+ * Source container is not modified.
+ * Created range wrapper will NOT own specified container.
+ *
+ * @param range source container
+ * @param kernel batch `FunctionObject`
+ * @param block_size number of elements to process with a single kernel call during iteration
+ * @return transformed range
+ */
+template<typename Out = void, typename Range, typename Kernel,
+        class = typename std::enable_if<is_contiguous_container<typename std::decay<Range>::type>::value>::type>
+batch_transformed_range<const Range&,
+        typename detail_batch::output_type<Out, typename Range::value_type>::type, Kernel>
+transform_batch(const Range& range, Kernel kernel, std::size_t block_size = 1024) {
+    return batch_transformed_range<const Range&,
+            typename detail_batch::output_type<Out, typename Range::value_type>::type, Kernel>(
+            range, std::move(kernel), block_size);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_TRANSFORM_BATCH_HPP */
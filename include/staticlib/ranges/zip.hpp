@@ -0,0 +1,599 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zip.hpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 7:00 PM
+ */
+
+#ifndef STATICLIB_RANGES_ZIP_HPP
+#define STATICLIB_RANGES_ZIP_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/size_hint.hpp"
+#include "staticlib/ranges/traits.hpp"
+
+namespace staticlib {
+namespace ranges {
+
+namespace detail_zip {
+
+/**
+ * Operations on all the source iterators, applied in the order of source ranges
+ * through compile-time recursion
+ */
+template<std::size_t I, std::size_t N>
+struct each_iter {
+    template<typename Tuple>
+    static bool any_exhausted(const Tuple& iters, const Tuple& ends) {
+        return !(std::get<I>(iters) != std::get<I>(ends)) ||
+                each_iter<I + 1, N>::any_exhausted(iters, ends);
+    }
+
+    // stops on the first exhausted source, so longer sources are not advanced needlessly
+    template<typename Tuple>
+    static bool increment(Tuple& iters, const Tuple& ends) {
+        ++std::get<I>(iters);
+        if (!(std::get<I>(iters) != std::get<I>(ends))) {
+            return false;
+        }
+        return each_iter<I + 1, N>::increment(iters, ends);
+    }
+
+    template<typename Tuple>
+    static void increment(Tuple& iters) {
+        ++std::get<I>(iters);
+        each_iter<I + 1, N>::increment(iters);
+    }
+};
+
+/**
+ * Operations on all the source iterators, terminal case
+ */
+template<std::size_t N>
+struct each_iter<N, N> {
+    template<typename Tuple>
+    static bool any_exhausted(const Tuple&, const Tuple&) {
+        return false;
+    }
+
+    template<typename Tuple>
+    static bool increment(Tuple&, const Tuple&) {
+        return true;
+    }
+
+    template<typename Tuple>
+    static void increment(Tuple&) { }
+};
+
+/**
+ * Size hint of the shortest of two ranges, exact only
+ * when both hints are exact
+ *
+ * @param a size hint of the first range
+ * @param b size hint of the second range
+ * @return size hint of the shortest range
+ */
+inline size_hint shortest(const size_hint& a, const size_hint& b) {
+    if (!a.is_known()) {
+        return b.is_known() ? b.as_upper_bound() : a;
+    }
+    if (!b.is_known()) {
+        return a.as_upper_bound();
+    }
+    std::size_t value = a.value() < b.value() ? a.value() : b.value();
+    return a.is_exact() && b.is_exact() ? size_hint::exact(value) : size_hint::upper_bound(value);
+}
+
+/**
+ * Random-access iterator over the unbounded sequence of indices `0, 1, ...`,
+ * indices are returned by value, so `iterator_category` is `std::input_iterator_tag`
+ */
+class index_iter {
+    std::size_t idx;
+
+public:
+    using value_type = std::size_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::nullptr_t;
+    using reference = std::size_t;
+
+    explicit index_iter(std::size_t idx) :
+    idx(idx) { }
+
+    index_iter& operator++() {
+        this->idx += 1;
+        return *this;
+    }
+
+    index_iter operator+(difference_type n) const {
+        return index_iter(idx + static_cast<std::size_t>(n));
+    }
+
+    difference_type operator-(const index_iter& other) const {
+        return static_cast<difference_type>(idx - other.idx);
+    }
+
+    std::size_t operator*() const {
+        return idx;
+    }
+
+    bool operator!=(const index_iter& other) const {
+        return idx != other.idx;
+    }
+};
+
+/**
+ * Unbounded range of indices, used as a first source for `enumerate`,
+ * it is skipped when the size hint of zipped sources is computed and its
+ * slice size is reported as maximum `size_t` value, so it never is
+ * the shortest of zipped ranges
+ */
+class index_range {
+public:
+    index_iter begin() const {
+        return index_iter(0);
+    }
+
+    index_iter end() const {
+        return index_iter(slice_size());
+    }
+
+    size_hint get_size_hint() const {
+        return size_hint::unknown();
+    }
+
+    std::size_t slice_size() const {
+        return static_cast<std::size_t>(-1);
+    }
+};
+
+/**
+ * Size hint of the shortest of the specified source and the rest of the sources,
+ * unbounded `index_range` does not limit the size of the zipped range
+ */
+template<typename Range>
+size_hint shortest(const Range& range, const size_hint& rest) {
+    return shortest(staticlib::ranges::get_size_hint(range), rest);
+}
+
+inline size_hint shortest(const index_range&, const size_hint& rest) {
+    return rest;
+}
+
+/**
+ * Operations on all the source ranges, the last source ends the recursion
+ */
+template<std::size_t I, std::size_t N, bool Last = (I + 1 == N)>
+struct each_source {
+    template<typename Tuple>
+    static size_hint hint(const Tuple& sources) {
+        return shortest(std::get<I>(sources), each_source<I + 1, N>::hint(sources));
+    }
+
+    template<typename Tuple>
+    static std::size_t slice_size(const Tuple& sources) {
+        std::size_t size = detail_fusion::get_slice_size(std::get<I>(sources));
+        std::size_t rest = each_source<I + 1, N>::slice_size(sources);
+        return size < rest ? size : rest;
+    }
+};
+
+/**
+ * Operations on all the source ranges, the last source
+ */
+template<std::size_t I, std::size_t N>
+struct each_source<I, N, true> {
+    template<typename Tuple>
+    static size_hint hint(const Tuple& sources) {
+        return staticlib::ranges::get_size_hint(std::get<I>(sources));
+    }
+
+    template<typename Tuple>
+    static std::size_t slice_size(const Tuple& sources) {
+        return detail_fusion::get_slice_size(std::get<I>(sources));
+    }
+};
+
+/**
+ * Type trait to detect ranges, which can be zipped in slices:
+ * sliceable ranges with random-access iterators
+ */
+template<typename... Ranges>
+struct all_sliceable : std::true_type { };
+
+/**
+ * Type trait to detect ranges, which can be zipped in slices:
+ * sliceable ranges with random-access iterators
+ */
+template<typename Range, typename... Ranges>
+struct all_sliceable<Range, Ranges...> : std::integral_constant<bool,
+        detail_fusion::is_sliceable<Range>::value &&
+        is_random_access_iterator<decltype(std::declval<Range&>().begin())>::value &&
+        all_sliceable<Ranges...>::value> { };
+
+} // namespace
+
+/**
+ * Lazy `InputIterator` implementation for `zip` operation.
+ * Does not support `CopyConstructible`, `CopyAssignable` and `Swappable`.
+ * Keeps pairs of source iterators, all of them are advanced in lockstep,
+ * iteration ends when any of the sources is exhausted.
+ * Elements of all sources are moved out from `operator*` method
+ * together as a single tuple.
+ */
+template<typename Elem, typename... Iters>
+class zipped_iter {
+    std::tuple<Iters...> source_iters;
+    std::tuple<Iters...> source_iters_end;
+    bool exhausted;
+
+public:
+    using value_type = Elem;
+    // does not support input_iterator, but valid tag is required
+    // for std::iterator_traits with libc++ on mac
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::nullptr_t;
+    using pointer = std::nullptr_t;
+    using reference = std::nullptr_t;
+
+    /**
+     * Constructor
+     *
+     * @param source_iters `begin` source iterators
+     * @param source_iters_end `past_the_end` source iterators
+     */
+    zipped_iter(std::tuple<Iters...>&& source_iters, std::tuple<Iters...>&& source_iters_end) :
+    source_iters(std::move(source_iters)),
+    source_iters_end(std::move(source_iters_end)),
+    exhausted(detail_zip::each_iter<0, sizeof...(Iters)>::any_exhausted(
+            this->source_iters, this->source_iters_end)) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    zipped_iter(const zipped_iter& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    zipped_iter& operator=(const zipped_iter& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    zipped_iter(zipped_iter&& other) :
+    source_iters(std::move(other.source_iters)),
+    source_iters_end(std::move(other.source_iters_end)),
+    exhausted(other.exhausted) { }
+
+    /**
+     * Move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    zipped_iter& operator=(zipped_iter&& other) {
+        this->source_iters = std::move(other.source_iters);
+        this->source_iters_end = std::move(other.source_iters_end);
+        this->exhausted = other.exhausted;
+        return *this;
+    }
+
+    /**
+     * Increments all source iterators
+     *
+     * @return reference to this iterator
+     */
+    zipped_iter& operator++() {
+        next();
+        return *this;
+    }
+
+    /**
+     * Increments all source iterators
+     *
+     * @return reference to this iterator
+     */
+    zipped_iter& operator++(int) {
+        next();
+        return *this;
+    }
+
+    /**
+     * Will move out current elements of all sources
+     *
+     * @return tuple of current elements
+     */
+    Elem operator*() {
+        return deref(make_index_sequence<sizeof...(Iters)>());
+    }
+
+    /**
+     * Delegated operator implementation, does NOT support arbitrary input instances,
+     * should be used only to compare with `past_the_end` iterator.
+     *
+     * @param end "past the end" iterator
+     * @return whether not both this and specified iterators are "past the end"
+     */
+    bool operator!=(const zipped_iter& end) const {
+        return this->exhausted != end.exhausted;
+    }
+
+private:
+    void next() {
+        if (!exhausted) {
+            this->exhausted = !detail_zip::each_iter<0, sizeof...(Iters)>::increment(
+                    source_iters, source_iters_end);
+        }
+    }
+
+    template<std::size_t... Indices>
+    Elem deref(index_sequence<Indices...>) {
+        return Elem(std::move(*std::get<Indices>(source_iters))...);
+    }
+};
+
+/**
+ * Lazy implementation of `SinglePassRange` for `zip` operation
+ * over an arbitrary number of source ranges, that are iterated in lockstep.
+ * Elements of all source ranges are moved into a single `std::tuple` per
+ * result element (sources, that are taken by reference, yield `std::reference_wrapper`
+ * elements), no intermediate storage is allocated. Iteration ends on the end
+ * of the shortest source range.
+ * When all source ranges are sliceable and have random-access iterators
+ * (e.g. parallel vectors of columnar data), slices can be pushed to sinks
+ * independently, so parallel operations (see `parallel_policy`)
+ * can be applied to the wrappers over this range.
+ */
+template<typename... Ranges>
+class zipped_range {
+    static_assert(sizeof...(Ranges) > 0, "At least one source range must be specified");
+
+    std::tuple<Ranges...> source_ranges;
+
+public:
+    /**
+     * Result value type of iterators returned from this range
+     */
+    using value_type = std::tuple<typename std::iterator_traits<
+            decltype(std::declval<Ranges&>().begin())>::value_type...>;
+
+    /**
+     * Result iterator type
+     */
+    using zipped_iterator = zipped_iter<value_type, decltype(std::declval<Ranges&>().begin())...>;
+
+    /**
+     * Constructor,
+     * created range wrapper will own specified ranges
+     *
+     * @param source_ranges source ranges
+     */
+    zipped_range(Ranges&&... source_ranges) :
+    source_ranges(std::move(source_ranges)...) { }
+
+    /**
+     * Deleted copy constructor
+     *
+     * @param other other instance
+     */
+    zipped_range(const zipped_range& other) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    zipped_range& operator=(const zipped_range& other) = delete;
+
+    /**
+     * Move constructor
+     *
+     * @param other other instance
+     */
+    zipped_range(zipped_range&& other) :
+    source_ranges(std::move(other.source_ranges)) { }
+
+    /**
+     * Deleted move assignment operator
+     *
+     * @param other other instance
+     * @return reference to this instance
+     */
+    zipped_range& operator=(zipped_range&& other) = delete;
+
+    /**
+     * Returns `begin` zipped iterator
+     *
+     * @return `begin` iterator
+     */
+    zipped_iterator begin() {
+        return begin(make_index_sequence<sizeof...(Ranges)>());
+    }
+
+    /**
+     * Returns `past_the_end` iterator
+     *
+     * @return `past_the_end` iterator
+     */
+    zipped_iterator end() {
+        return end(make_index_sequence<sizeof...(Ranges)>());
+    }
+
+    /**
+     * Returns size hint of this range, the size hint
+     * of the shortest source range
+     *
+     * @return size hint
+     */
+    size_hint get_size_hint() const {
+        return detail_zip::each_source<0, sizeof...(Ranges)>::hint(source_ranges);
+    }
+
+    /**
+     * Returns the size of the shortest source range,
+     * available only for sliceable random-access source ranges
+     *
+     * @return size of the shortest source range
+     */
+    template<typename T = value_type,
+            class = typename std::enable_if<std::is_same<T, value_type>::value &&
+                    detail_zip::all_sliceable<Ranges...>::value>::type>
+    std::size_t slice_size() const {
+        return detail_zip::each_source<0, sizeof...(Ranges)>::slice_size(source_ranges);
+    }
+
+    /**
+     * Pushes tuples of the elements with indices `[from, to)` of all source ranges
+     * into the specified sink, available only for sliceable random-access source ranges
+     *
+     * @param sink `FunctionObject` to push elements into
+     * @param from index of the first element
+     * @param to index past the last element
+     * @return false if iteration was stopped by sink, true otherwise
+     */
+    template<typename Sink, typename T = value_type,
+            class = typename std::enable_if<std::is_same<T, value_type>::value &&
+                    detail_zip::all_sliceable<Ranges...>::value>::type>
+    bool fused_for_each_slice(Sink& sink, std::size_t from, std::size_t to) {
+        return for_each_slice(sink, from, to, make_index_sequence<sizeof...(Ranges)>());
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector.
+     *
+     * @return vector with processed elements
+     */
+    std::vector<value_type> to_vector() {
+        return detail_fusion::collect(*this, std::vector<value_type>());
+    }
+
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified allocator
+     * (e.g. arena allocator) for its storage.
+     *
+     * @param alloc allocator, rebound to the element type
+     * @return vector with processed elements
+     */
+    template<typename Alloc, class = typename std::enable_if<is_allocator<Alloc>::value>::type>
+    typename allocated_vector<value_type, Alloc>::type to_vector(const Alloc& alloc) {
+        return detail_fusion::collect_allocated<value_type>(*this, alloc);
+    }
+
+#ifdef STATICLIB_RANGES_PMR
+    /**
+     * Process this range eagerly returning results as
+     * a newly-allocated vector, that uses specified memory resource
+     * (e.g. `std::pmr::monotonic_buffer_resource`) for its storage.
+     *
+     * @param resource memory resource
+     * @return vector with processed elements
+     */
+    std::pmr::vector<value_type> to_vector(std::pmr::memory_resource* resource) {
+        return to_vector(std::pmr::polymorphic_allocator<value_type>(resource));
+    }
+#endif // STATICLIB_RANGES_PMR
+
+private:
+    template<std::size_t... Indices>
+    zipped_iterator begin(index_sequence<Indices...>) {
+        // move here is required by msvs
+        return zipped_iterator(
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).begin())...),
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...));
+    }
+
+    template<std::size_t... Indices>
+    zipped_iterator end(index_sequence<Indices...>) {
+        return zipped_iterator(
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...),
+                std::make_tuple(std::move(std::get<Indices>(source_ranges).end())...));
+    }
+
+    template<typename Sink, std::size_t... Indices>
+    bool for_each_slice(Sink& sink, std::size_t from, std::size_t to, index_sequence<Indices...>) {
+        // source iterators are created per slice, sources are not modified
+        auto iters = std::make_tuple((std::get<Indices>(source_ranges).begin() +
+                static_cast<typename std::iterator_traits<decltype(std::get<Indices>(source_ranges).begin())>::
+                        difference_type>(from))...);
+        for (std::size_t i = from; i < to; i++) {
+            if (!sink(value_type(std::move(*std::get<Indices>(iters))...))) {
+                return false;
+            }
+            detail_zip::each_iter<0, sizeof...(Ranges)>::increment(iters);
+        }
+        return true;
+    }
+};
+
+/**
+ * Lazily zips input ranges into single output range of tuples,
+ * see `zipped_range`. Iteration ends on the end of the shortest source range.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param ranges source ranges
+ * @return zipped range
+ */
+template<typename... Ranges>
+zipped_range<typename detail_refwrap::adapted<Ranges>::type...> zip(Ranges&&... ranges) {
+    return zipped_range<typename detail_refwrap::adapted<Ranges>::type...>(
+            detail_refwrap::adapted<Ranges>::adapt(std::forward<Ranges>(ranges))...);
+}
+
+/**
+ * Lazily pairs the elements of the input range with their indices,
+ * result elements are `std::tuple<std::size_t, Elem>`, see `zipped_range`.
+ * Temporary ranges and ranges, which contain `std::reference_wrapper` elements, will be owned
+ * by the created range wrapper, elements of other ranges are taken by reference.
+ *
+ * @param range source range
+ * @return enumerated range
+ */
+template<typename Range>
+zipped_range<detail_zip::index_range, typename detail_refwrap::adapted<Range>::type> enumerate(Range&& range) {
+    return zipped_range<detail_zip::index_range, typename detail_refwrap::adapted<Range>::type>(
+            detail_zip::index_range(), detail_refwrap::adapted<Range>::adapt(std::forward<Range>(range)));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_RANGES_ZIP_HPP */
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   batch_kernels_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 6:05 PM
+ */
+
+#include "staticlib/ranges/batch_kernels.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+const sl::ranges::simd_level levels[] = {
+    sl::ranges::simd_level::SCALAR,
+    sl::ranges::simd_level::SSE2,
+    sl::ranges::simd_level::AVX2
+};
+
+template<typename T, typename Kernel, typename Expected>
+void check(const std::vector<T>& in, Kernel kernel, Expected expected) {
+    auto out = std::vector<T>(in.size());
+    kernel(in.data(), in.size(), out.data());
+    for (size_t i = 0; i < in.size(); i++) {
+        slassert(expected(in[i]) == out[i]);
+    }
+    // in-place
+    auto inplace = in;
+    kernel(inplace.data(), inplace.size(), inplace.data());
+    slassert(out == inplace);
+}
+
+void test_levels() {
+    auto detected = sl::ranges::detect_simd_level();
+    auto kernel = sl::ranges::batch_add(1.0f);
+    slassert(detected == kernel.get_level());
+    auto scalar = sl::ranges::batch_add(1.0f, sl::ranges::simd_level::SCALAR);
+    slassert(sl::ranges::simd_level::SCALAR == scalar.get_level());
+}
+
+void test_kernels() {
+    // odd size to cover the scalar tail
+    auto fl = std::vector<float>();
+    auto db = std::vector<double>();
+    auto i32 = std::vector<int32_t>();
+    auto u64 = std::vector<uint64_t>();
+    for (int i = 0; i < 37; i++) {
+        fl.push_back(static_cast<float>(i) * 0.5f);
+        db.push_back(static_cast<double>(i) * 0.25);
+        i32.push_back(i * 1000 - 7000);
+        u64.push_back(static_cast<uint64_t>(i) << 40);
+    }
+    i32.push_back((std::numeric_limits<int32_t>::max)());
+    u64.push_back((std::numeric_limits<uint64_t>::max)());
+
+    for (auto level : levels) {
+        check(fl, sl::ranges::batch_add(1.5f, level), [](float el) { return el + 1.5f; });
+        check(fl, sl::ranges::batch_multiply(3.0f, level), [](float el) { return el * 3.0f; });
+        check(db, sl::ranges::batch_add(0.5, level), [](double el) { return el + 0.5; });
+        check(db, sl::ranges::batch_multiply(-2.0, level), [](double el) { return el * -2.0; });
+        check(i32, sl::ranges::batch_add(int32_t(42), level), [](int32_t el) {
+            return static_cast<int32_t>(static_cast<uint32_t>(el) + 42u);
+        });
+        check(i32, sl::ranges::batch_multiply(int32_t(-3), level), [](int32_t el) {
+            return static_cast<int32_t>(static_cast<uint32_t>(el) * static_cast<uint32_t>(-3));
+        });
+        check(u64, sl::ranges::batch_add(uint64_t(3), level), [](uint64_t el) { return el + 3; });
+        check(u64, sl::ranges::batch_multiply(uint64_t(5), level), [](uint64_t el) { return el * 5; });
+    }
+}
+
+int main() {
+    try {
+        test_levels();
+        test_kernels();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   batch_range_adapter_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 10:45 PM
+ */
+
+#include "staticlib/ranges/batch_range_adapter.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+class my_pages_range : public sl::ranges::batch_range_adapter<my_pages_range, my_movable> {
+    std::vector<std::size_t> page_sizes;
+    std::size_t page_idx = 0;
+    int count = 0;
+
+public:
+    int batches_requested = 0;
+
+    my_pages_range(std::vector<std::size_t> page_sizes) :
+    sl::ranges::batch_range_adapter<my_pages_range, my_movable>(4),
+    page_sizes(std::move(page_sizes)) { }
+
+    my_pages_range(my_pages_range&& other) :
+    sl::ranges::batch_range_adapter<my_pages_range, my_movable>(std::move(other)),
+    page_sizes(std::move(other.page_sizes)),
+    page_idx(other.page_idx),
+    count(other.count),
+    batches_requested(other.batches_requested) { }
+
+    bool compute_next_batch(std::vector<my_movable>& buffer) {
+        batches_requested += 1;
+        if (page_idx < page_sizes.size()) {
+            for (std::size_t i = 0; i < page_sizes[page_idx]; i++) {
+                buffer.emplace_back(count++);
+            }
+            page_idx += 1;
+        }
+        return page_idx < page_sizes.size();
+    }
+
+    sl::ranges::size_hint get_size_hint() const {
+        std::size_t res = 0;
+        for (std::size_t i = page_idx; i < page_sizes.size(); i++) {
+            res += page_sizes[i];
+        }
+        return sl::ranges::size_hint::exact(res);
+    }
+};
+
+void test_iterate() {
+    // empty pages in between are skipped
+    auto range = my_pages_range({3, 0, 0, 2, 4});
+    auto res = std::vector<int>();
+    for (auto&& el : range) {
+        res.push_back(el.get_val());
+    }
+    slassert(9 == res.size());
+    for (int i = 0; i < 9; i++) {
+        slassert(i == res[i]);
+    }
+    slassert(5 == range.batches_requested);
+
+    bool thrown = false;
+    try {
+        range.begin();
+    } catch (const std::range_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+
+    auto empty = my_pages_range({});
+    auto count = 0;
+    for (auto&& el : empty) {
+        (void) el;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_fused() {
+    auto range = my_pages_range({4, 4, 1});
+    slassert(9 == sl::ranges::get_size_hint(range).value());
+    auto transformed = sl::ranges::transform(std::move(range), [](my_movable el) {
+        return el.get_val() * 10;
+    });
+    auto filtered = sl::ranges::filter(std::move(transformed), [](int el) {
+        return el >= 30;
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(filtered));
+    slassert(6 == res.size());
+    slassert(30 == res[0]);
+    slassert(80 == res[5]);
+}
+
+void test_stop() {
+    auto range = my_pages_range({4, 4, 4});
+    auto found = sl::ranges::any(range, [](my_movable& el) {
+        return 2 == el.get_val();
+    });
+    slassert(found);
+    // stopped within the first batch
+    slassert(1 == range.batches_requested);
+}
+
+int main() {
+    try {
+        test_iterate();
+        test_fused();
+        test_stop();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
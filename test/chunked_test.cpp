@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   chunked_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 4:50 PM
+ */
+
+#include "staticlib/ranges/chunked.hpp"
+
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_contiguous() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 10; i++) {
+        vec.push_back(i);
+    }
+    auto chunked = sl::ranges::chunked(vec, 4);
+    slassert(3 == chunked.get_size_hint().value());
+    auto sizes = std::vector<size_t>();
+    for (auto ch : chunked) {
+        // chunks point into the source
+        slassert(vec.data() + sizes.size() * 4 == ch.data());
+        sizes.push_back(ch.size());
+    }
+    slassert(3 == sizes.size());
+    slassert(4 == sizes[0]);
+    slassert(4 == sizes[1]);
+    slassert(2 == sizes[2]);
+
+    const auto& cvec = vec;
+    auto sums = sl::ranges::transform(sl::ranges::chunked(cvec, 5), [](sl::ranges::chunk<const int> ch) {
+        int sum = 0;
+        for (int el : ch) {
+            sum += el;
+        }
+        return sum;
+    }).to_vector();
+    slassert(2 == sums.size());
+    slassert(10 == sums[0]);
+    slassert(35 == sums[1]);
+
+    auto owned = sl::ranges::chunked(std::string("abcde"), 2);
+    auto parts = std::vector<std::string>();
+    for (auto ch : owned) {
+        parts.emplace_back(ch.begin(), ch.end());
+    }
+    slassert(3 == parts.size());
+    slassert("ab" == parts[0]);
+    slassert("e" == parts[2]);
+
+    auto empty = std::vector<int>();
+    auto count = 0;
+    for (auto ch : sl::ranges::chunked(empty, 4)) {
+        (void) ch;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_buffered() {
+    auto chunked = sl::ranges::chunked(my_counting_range(7), 3);
+    auto sizes = std::vector<size_t>();
+    int last = 0;
+    for (auto ch : chunked) {
+        sizes.push_back(ch.size());
+        for (auto& el : ch) {
+            slassert(last + 1 == el.get_val());
+            last = el.get_val();
+        }
+    }
+    slassert(3 == sizes.size());
+    slassert(3 == sizes[0]);
+    slassert(1 == sizes[2]);
+    slassert(7 == last);
+
+    auto li = std::list<my_movable>();
+    li.emplace_back(41);
+    li.emplace_back(42);
+    li.emplace_back(43);
+    auto sums = sl::ranges::transform(sl::ranges::chunked(li, 2),
+            [](sl::ranges::chunk<std::reference_wrapper<my_movable>> ch) {
+        int sum = 0;
+        for (my_movable& el : ch) {
+            sum += el.get_val();
+        }
+        return sum;
+    }).to_vector();
+    slassert(2 == sums.size());
+    slassert(83 == sums[0]);
+    slassert(43 == sums[1]);
+    // elements are taken by reference
+    slassert(41 == li.front().get_val());
+}
+
+void test_fused() {
+    auto chunked = sl::ranges::chunked(my_counting_range(5), 2);
+    auto sizes = std::vector<size_t>();
+    auto sink = [&sizes](sl::ranges::chunk<my_movable> ch) {
+        sizes.push_back(ch.size());
+        return sizes.size() < 2;
+    };
+    sl::ranges::fused_for_each(chunked, sink);
+    slassert(2 == sizes.size());
+
+    auto vec = std::vector<int>{1, 2, 3, 4, 5};
+    auto vec_chunked = sl::ranges::chunked(vec, 2);
+    auto found = sl::ranges::any(vec_chunked, [](sl::ranges::chunk<int> ch) {
+        return 5 == ch[0];
+    });
+    slassert(found);
+}
+
+int main() {
+    try {
+        test_contiguous();
+        test_buffered();
+        test_fused();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
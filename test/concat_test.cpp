@@ -24,6 +24,7 @@
 #include "staticlib/ranges/concat.hpp"
 
 #include <iostream>
+#include <type_traits>
 #include <vector>
 #include <list>
 #include <memory>
@@ -39,6 +40,9 @@
 // C++11 poor-mans variant of auto return
 using auto_1 = sl::ranges::concatted_range<std::vector<std::unique_ptr<my_int>>, std::list<std::unique_ptr<my_int>>>;
 
+static_assert(std::is_same<auto_1::iterator2, std::list<std::unique_ptr<my_int>>::iterator>::value,
+        "two-range iterator typedefs");
+
 auto_1 fun() {
     auto vec = std::vector<std::unique_ptr<my_int>>{};
     vec.emplace_back(new my_int(40));
@@ -187,6 +191,56 @@ void test_lvalue() {
     slassert(44 == res[4].get()->get_int());
 }
 
+void test_variadic() {
+    auto vec1 = std::vector<my_movable>();
+    vec1.emplace_back(1);
+    vec1.emplace_back(2);
+    auto vec_empty = std::vector<my_movable>();
+    auto list = std::list<my_movable>();
+    list.emplace_back(3);
+    auto vec2 = std::vector<my_movable>();
+    vec2.emplace_back(4);
+    vec2.emplace_back(5);
+    auto vec_empty_last = std::vector<my_movable>();
+
+    auto range = sl::ranges::concat(std::move(vec1), std::move(vec_empty), std::move(list),
+            std::move(vec2), std::move(vec_empty_last));
+    slassert(5 == range.get_size_hint().value());
+    auto res = std::vector<int>();
+    for (auto&& el : range) {
+        res.push_back(el.get_val());
+    }
+    slassert(5 == res.size());
+    for (int i = 0; i < 5; i++) {
+        slassert(i + 1 == res[i]);
+    }
+}
+
+void test_variadic_mixed() {
+    auto vec = std::vector<my_movable>();
+    vec.emplace_back(1);
+    auto list = std::list<my_movable>();
+    list.emplace_back(2);
+    auto owned = std::vector<my_movable>();
+    owned.emplace_back(3);
+
+    // lvalues are taken by reference, temporary ranges are owned
+    auto ra = sl::ranges::concat(vec, list, sl::ranges::refwrap(owned), sl::ranges::transform(vec,
+            [](my_movable& el) {
+        return std::ref(el);
+    }));
+    auto res = ra.to_vector();
+    slassert(4 == res.size());
+    slassert(1 == res[0].get().get_val());
+    slassert(2 == res[1].get().get_val());
+    slassert(3 == res[2].get().get_val());
+    slassert(1 == res[3].get().get_val());
+    slassert(1 == vec[0].get_val());
+
+    auto single = sl::ranges::concat(std::vector<int>{1, 2});
+    slassert(2 == single.to_vector().size());
+}
+
 int main() {
     try {
         test_fromfun();
@@ -197,6 +251,8 @@ int main() {
         test_ranges();
         test_moved();
         test_lvalue();
+        test_variadic();
+        test_variadic_mixed();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
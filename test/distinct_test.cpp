@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   distinct_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 1:30 PM
+ */
+
+#include "staticlib/ranges/distinct.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/fd_records.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+struct movable_hash {
+    std::size_t operator()(const my_movable& el) const {
+        return std::hash<int>()(el.get_val());
+    }
+};
+
+void test_strings() {
+    auto vec = std::vector<std::string>{"foo", "bar", "foo", "baz", "bar", "foo"};
+    auto res = std::vector<std::string>();
+    for (auto el : sl::ranges::distinct(vec)) {
+        res.push_back(el.get());
+    }
+    auto expected = std::vector<std::string>{"foo", "bar", "baz"};
+    slassert(expected == res);
+    // lvalue source is not moved from
+    slassert("foo" == vec[5]);
+}
+
+void test_offcast() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i % 100);
+    }
+    auto dups = std::vector<int>();
+    auto range = sl::ranges::distinct(std::move(vec), std::hash<int>(), std::equal_to<int>(), [&dups](int el) {
+        dups.push_back(el);
+    }, 128);
+    slassert(1000 == range.get_size_hint().value());
+    slassert(!range.get_size_hint().is_exact());
+    auto res = sl::ranges::emplace_to_vector(std::move(range));
+    slassert(100 == res.size());
+    for (int i = 0; i < 100; i++) {
+        slassert(i == res[i]);
+    }
+    slassert(900 == dups.size());
+}
+
+void test_offcast_batch() {
+    auto vec = std::vector<int>{1, 2, 1, 3, 2};
+    auto dups = std::vector<int>();
+    auto range = sl::ranges::distinct(std::move(vec), std::hash<int>(), std::equal_to<int>(),
+            sl::ranges::offcast_batch<std::vector<int>>(dups));
+    auto res = std::vector<int>();
+    for (int el : range) {
+        res.push_back(el);
+    }
+    slassert(3 == res.size());
+    // delivered on exhaustion, before the range is destroyed
+    slassert(2 == dups.size());
+    slassert(1 == dups[0]);
+    slassert(2 == dups[1]);
+
+    auto vec2 = std::vector<int>{4, 4, 5, 4};
+    auto dups2 = std::vector<int>();
+    auto range2 = sl::ranges::distinct(std::move(vec2), std::hash<int>(), std::equal_to<int>(),
+            sl::ranges::offcast_batch<std::vector<int>>(dups2));
+    slassert(2 == sl::ranges::count(range2));
+    slassert(2 == dups2.size());
+}
+
+void test_movable() {
+    auto vec = std::vector<int>{1, 2, 1, 3, 2};
+    auto range = sl::ranges::transform(std::move(vec), [](int el) {
+        return my_movable(el);
+    });
+    auto dups = std::vector<int>();
+    // move-only elements cannot be copied into the set, only hashes are kept
+    auto distinct = sl::ranges::distinct_hashes(std::move(range), movable_hash(),
+            [&dups](my_movable el) {
+        dups.push_back(el.get_val());
+    });
+    auto res = std::vector<int>();
+    for (auto el : distinct) {
+        res.push_back(el.get_val());
+    }
+    slassert(3 == res.size());
+    slassert(1 == res[0]);
+    slassert(2 == res[1]);
+    slassert(3 == res[2]);
+    slassert(2 == dups.size());
+    slassert(1 == dups[0]);
+    slassert(2 == dups[1]);
+}
+
+void test_hashes() {
+    auto vec = std::vector<std::string>();
+    for (int i = 0; i < 10000; i++) {
+        vec.push_back("event_" + std::to_string(i % 2500));
+    }
+    auto range = sl::ranges::distinct_hashes(std::move(vec));
+    auto res = sl::ranges::count(range);
+    slassert(2500 == res);
+
+    auto vec2 = std::vector<std::string>{"a", "b", "a"};
+    auto dups = std::vector<std::string>();
+    auto range2 = sl::ranges::distinct_hashes(std::move(vec2), std::hash<std::string>(),
+            [&dups](std::string el) {
+        dups.push_back(std::move(el));
+    });
+    auto res2 = sl::ranges::emplace_to_vector(std::move(range2));
+    slassert(2 == res2.size());
+    slassert(1 == dups.size());
+    slassert("a" == dups[0]);
+}
+
+void test_iterate_then_fused() {
+    auto vec = std::vector<int>{1, 1, 2, 2, 3, 3, 4};
+    auto range = sl::ranges::distinct(std::move(vec));
+    auto found = sl::ranges::find(range, [](int el) {
+        return 2 == el;
+    }, -1);
+    slassert(2 == found);
+    auto rest = std::vector<int>();
+    for (int el : range) {
+        rest.push_back(el);
+    }
+    slassert(2 == rest.size());
+    slassert(3 == rest[0]);
+    slassert(4 == rest[1]);
+}
+
+void test_records() {
+    // returned views point into the source buffer, that is reused on the next read
+    auto data = std::string();
+    for (int i = 0; i < 50; i++) {
+        data += "record_" + std::to_string(i) + "\n";
+    }
+    int fds[2];
+    slassert(0 == ::pipe(fds));
+    slassert(static_cast<ssize_t>(data.size()) == ::write(fds[1], data.data(), data.size()));
+    ::close(fds[1]);
+    auto hash = [](const sl::ranges::record_view& rec) {
+        return std::hash<std::string>()(rec.str());
+    };
+    auto range = sl::ranges::distinct_hashes(sl::ranges::fd_records(fds[0], '\n', 16), hash,
+            sl::ranges::ignore_offcast<sl::ranges::record_view>);
+    auto res = std::vector<std::string>();
+    for (auto rec : range) {
+        res.push_back(rec.str());
+        if (25 == res.size()) {
+            break;
+        }
+    }
+    res = sl::ranges::fold(range, std::move(res), [](std::vector<std::string>&& acc, sl::ranges::record_view rec) {
+        acc.push_back(rec.str());
+        return std::move(acc);
+    });
+    ::close(fds[0]);
+    slassert(50 == res.size());
+    for (int i = 0; i < 50; i++) {
+        slassert("record_" + std::to_string(i) == res[i]);
+    }
+}
+
+int main() {
+    try {
+        test_strings();
+        test_offcast();
+        test_offcast_batch();
+        test_movable();
+        test_hashes();
+        test_iterate_then_fused();
+        test_records();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -24,8 +24,13 @@
 #ifndef STATICLIB_RANGES_TEST_DOMAIN_CLASSES_HPP
 #define STATICLIB_RANGES_TEST_DOMAIN_CLASSES_HPP
 
+#include <cstddef>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
+
+#include "staticlib/ranges/range_adapter.hpp"
 
 class my_int {
     int val;
@@ -118,5 +123,86 @@ public:
     }
 };
 
+class my_counting_range : public staticlib::ranges::range_adapter<my_counting_range, my_movable> {
+    const int max;
+    int count = 0;
+
+public:
+    my_counting_range(int max) :
+    max(max) { }
+
+    my_counting_range(my_counting_range&& other) :
+    max(other.max),
+    count(other.count) { }
+
+    bool compute_next() {
+        if (count < max) {
+            count += 1;
+            return this->set_current(my_movable{count});
+        } else {
+            return false;
+        }
+    }
+};
+
+class my_calls_counting_range : public staticlib::ranges::range_adapter<my_calls_counting_range, my_movable> {
+    int val = 0;
+    int max;
+    int* calls;
+
+public:
+    my_calls_counting_range(int max, int& calls) :
+    max(max),
+    calls(std::addressof(calls)) { }
+
+    my_calls_counting_range(my_calls_counting_range&& other) :
+    staticlib::ranges::range_adapter<my_calls_counting_range, my_movable>(std::move(other)),
+    val(other.val),
+    max(other.max),
+    calls(other.calls) { }
+
+    bool compute_next() {
+        *calls += 1;
+        if (val < max) {
+            return this->set_current(my_movable(val++));
+        }
+        return false;
+    }
+};
+
+template<typename T>
+class my_counting_allocator {
+public:
+    using value_type = T;
+
+    std::shared_ptr<std::size_t> allocations;
+
+    my_counting_allocator() :
+    allocations(std::make_shared<std::size_t>(0)) { }
+
+    template<typename U>
+    my_counting_allocator(const my_counting_allocator<U>& other) :
+    allocations(other.allocations) { }
+
+    T* allocate(std::size_t n) {
+        *allocations += 1;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) {
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template<typename U>
+    bool operator==(const my_counting_allocator<U>& other) const {
+        return allocations == other.allocations;
+    }
+
+    template<typename U>
+    bool operator!=(const my_counting_allocator<U>& other) const {
+        return allocations != other.allocations;
+    }
+};
+
 #endif /* STATICLIB_RANGES_TEST_DOMAIN_CLASSES_HPP */
 
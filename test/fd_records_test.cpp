@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   fd_records_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 12:30 AM
+ */
+
+#include "staticlib/ranges/fd_records.hpp"
+
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+// writes data into the pipe from the separate thread in small pieces
+class pipe_writer {
+    int fds[2];
+    std::thread writer;
+
+public:
+    pipe_writer(std::string data, std::size_t piece) {
+        slassert(0 == ::pipe(fds));
+        int wfd = fds[1];
+        writer = std::thread([wfd, data, piece] {
+            for (std::size_t pos = 0; pos < data.size(); pos += piece) {
+                std::size_t len = data.size() - pos < piece ? data.size() - pos : piece;
+                auto res = ::write(wfd, data.data() + pos, len);
+                (void) res;
+            }
+            ::close(wfd);
+        });
+    }
+
+    ~pipe_writer() {
+        writer.join();
+        ::close(fds[0]);
+    }
+
+    int read_fd() {
+        return fds[0];
+    }
+};
+
+void test_lines() {
+    pipe_writer pw("foo\n\nbar\nbaz", 3);
+    auto res = std::vector<std::string>();
+    for (auto rec : sl::ranges::fd_records(pw.read_fd())) {
+        res.push_back(rec.str());
+    }
+    slassert(4 == res.size());
+    slassert("foo" == res[0]);
+    slassert("" == res[1]);
+    slassert("bar" == res[2]);
+    slassert("baz" == res[3]);
+}
+
+void test_small_buffer() {
+    // records crossing block boundaries and records longer than buffer
+    auto data = std::string();
+    auto expected = std::vector<std::string>();
+    for (int i = 0; i < 500; i++) {
+        auto rec = std::string(static_cast<std::size_t>((i * 13) % 50), static_cast<char>('a' + i % 26));
+        if (0 == i % 100) {
+            rec = std::string(1000, 'x');
+        }
+        data += rec;
+        data += ';';
+        expected.push_back(rec);
+    }
+    pipe_writer pw(data, 7);
+    auto res = std::vector<std::string>();
+    for (auto rec : sl::ranges::fd_records(pw.read_fd(), ';', 16)) {
+        res.push_back(rec.str());
+    }
+    slassert(expected == res);
+}
+
+void test_fused() {
+    pipe_writer pw("INFO start\nERROR disk\nINFO work\nERROR net\n", 5);
+    auto errors = sl::ranges::transform(sl::ranges::filter(sl::ranges::fd_records(pw.read_fd(), '\n', 8),
+            [](const sl::ranges::record_view& rec) {
+        return rec.size() >= 5 && 0 == rec.str().compare(0, 5, "ERROR");
+    }), [](sl::ranges::record_view rec) {
+        return rec.str();
+    });
+    auto res = errors.to_vector();
+    slassert(2 == res.size());
+    slassert("ERROR disk" == res[0]);
+    slassert("ERROR net" == res[1]);
+}
+
+void test_error() {
+    bool thrown = false;
+    try {
+        for (auto rec : sl::ranges::fd_records(-1)) {
+            (void) rec;
+        }
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_lines();
+        test_small_buffer();
+        test_fused();
+        test_error();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // POSIX
+
+int main() {
+    std::cout << "File descriptor sources are not supported on this platform" << std::endl;
+    return 0;
+}
+
+#endif // POSIX
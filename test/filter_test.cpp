@@ -35,6 +35,35 @@
 
 #include "domain_classes.hpp"
 
+class move_counting {
+    int val;
+    
+public:
+    static int moves;
+
+    move_counting(int val) : val(val) { }
+
+    move_counting(const move_counting&) = delete;
+    move_counting& operator=(const move_counting&) = delete;
+
+    move_counting(move_counting&& other) :
+    val(other.val) {
+        moves += 1;
+    }
+
+    move_counting& operator=(move_counting&& other) {
+        val = other.val;
+        moves += 1;
+        return *this;
+    }
+
+    int get_val() const {
+        return val;
+    }
+};
+
+int move_counting::moves = 0;
+
 void test_vector() {
     auto vec = std::vector<std::unique_ptr<my_int>>{};
     vec.emplace_back(new my_int(40));
@@ -132,6 +161,32 @@ void test_lvalue() {
     slassert(43 == res[1].get().get_val());
 }
 
+void test_in_place() {
+    auto vec = std::vector<move_counting>{};
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(i);
+    }
+    auto offcasted = std::vector<int>{};
+    auto filtered = sl::ranges::filter(std::move(vec), [](move_counting& el) {
+        return 0 == el.get_val() % 5;
+    }, [&offcasted](move_counting el) {
+        offcasted.push_back(el.get_val());
+    });
+    move_counting::moves = 0;
+    auto matched = std::vector<int>{};
+    for (auto&& el : filtered) {
+        matched.push_back(el.get_val());
+    }
+    // each element is moved exactly once: accepted ones out of iterator,
+    // offcast ones into the destination
+    slassert(10 == move_counting::moves);
+    slassert(2 == matched.size());
+    slassert(0 == matched[0]);
+    slassert(5 == matched[1]);
+    slassert(8 == offcasted.size());
+    slassert(9 == offcasted[7]);
+}
+
 int main() {
     try {
         test_vector();
@@ -139,6 +194,7 @@ int main() {
         test_non_default_constructible();
         test_moved();
         test_lvalue();
+        test_in_place();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   flat_hash_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 9:20 AM
+ */
+
+#include "staticlib/ranges/flat_hash.hpp"
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "domain_classes.hpp"
+
+void test_insert_find() {
+    auto map = sl::ranges::flat_hash_map<int, std::string>();
+    slassert(map.empty());
+    slassert(map.end() == map.find(42));
+    for (int i = 0; i < 1000; i++) {
+        auto res = map.emplace(i * 8, std::to_string(i));
+        slassert(res.second);
+        slassert(i * 8 == res.first->first);
+    }
+    slassert(1000 == map.size());
+    for (int i = 0; i < 1000; i++) {
+        auto it = map.find(i * 8);
+        slassert(map.end() != it);
+        slassert(std::to_string(i) == it->second);
+        slassert(!map.contains(i * 8 + 1));
+    }
+    // existing key, value is not replaced
+    auto res = map.emplace(8, "foo");
+    slassert(!res.second);
+    slassert("1" == res.first->second);
+    slassert(1000 == map.size());
+
+    map[8] += "0";
+    map[8000] += "bar";
+    slassert("10" == map.find(8)->second);
+    slassert("bar" == map.find(8000)->second);
+    slassert(1001 == map.size());
+}
+
+void test_iterate() {
+    sl::ranges::flat_hash_map<std::string, int> map(100);
+    map.emplace("foo", 1);
+    map.emplace("bar", 2);
+    map.emplace("baz", 3);
+    int sum = 0;
+    std::size_t count = 0;
+    for (auto& en : map) {
+        sum += en.second;
+        count += 1;
+    }
+    slassert(3 == count);
+    slassert(6 == sum);
+
+    const auto& cmap = map;
+    slassert(2 == cmap.find("bar")->second);
+    slassert(cmap.end() == cmap.find("42"));
+
+    map.clear();
+    slassert(map.empty());
+    slassert(map.begin() == map.end());
+    map.emplace("foo", 42);
+    slassert(42 == map["foo"]);
+}
+
+void test_movable() {
+    auto map = sl::ranges::flat_hash_map<int, my_movable>();
+    for (int i = 0; i < 100; i++) {
+        map.emplace(i, i + 1);
+    }
+    auto moved = std::move(map);
+    slassert(map.empty());
+    slassert(100 == moved.size());
+    for (int i = 0; i < 100; i++) {
+        slassert(i + 1 == moved.find(i)->second.get_val());
+    }
+    map = std::move(moved);
+    slassert(100 == map.size());
+    slassert(42 == map.find(41)->second.get_val());
+}
+
+void test_set() {
+    sl::ranges::flat_hash_set<std::string> set(4);
+    slassert(set.insert("foo"));
+    slassert(set.insert("bar"));
+    slassert(!set.insert("foo"));
+    for (int i = 0; i < 100; i++) {
+        set.insert(std::to_string(i));
+    }
+    slassert(102 == set.size());
+    slassert(set.contains("42"));
+    slassert(!set.contains("baz"));
+    slassert("bar" == *set.find("bar"));
+    std::size_t count = 0;
+    for (const std::string& key : set) {
+        slassert(set.contains(key));
+        count += 1;
+    }
+    slassert(102 == count);
+}
+
+void test_const_keys() {
+    using map_type = sl::ranges::flat_hash_map<std::string, int>;
+    static_assert(std::is_same<std::pair<const std::string, int>&,
+            decltype(*std::declval<map_type&>().begin())>::value, "const key");
+    // const keys are copied on growth
+    auto map = sl::ranges::flat_hash_map<std::shared_ptr<int>, int>();
+    auto ptrs = std::vector<int*>();
+    for (int i = 0; i < 100; i++) {
+        auto ptr = std::shared_ptr<int>(new int(i));
+        ptrs.push_back(ptr.get());
+        map.emplace(std::move(ptr), i);
+    }
+    slassert(100 == map.size());
+    for (auto& en : map) {
+        slassert(*en.first == en.second);
+        slassert(ptrs[en.second] == en.first.get());
+        slassert(1 == en.first.use_count());
+    }
+}
+
+void test_too_large() {
+    auto map = sl::ranges::flat_hash_map<int, int>();
+    bool thrown = false;
+    try {
+        map.reserve(static_cast<std::size_t>(-1) - 1);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    thrown = false;
+    try {
+        sl::ranges::flat_hash_set<int> set((static_cast<std::size_t>(-1) >> 1) + 1);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+    slassert(map.empty());
+    map.emplace(1, 2);
+    slassert(2 == map[1]);
+}
+
+int main() {
+    try {
+        test_insert_find();
+        test_iterate();
+        test_movable();
+        test_set();
+        test_const_keys();
+        test_too_large();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   flatten_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 8:05 PM
+ */
+
+#include "staticlib/ranges/flatten.hpp"
+
+#include <iostream>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_owned() {
+    auto vec = std::vector<std::vector<std::unique_ptr<my_int>>>();
+    vec.emplace_back();
+    vec.back().emplace_back(new my_int(1));
+    vec.back().emplace_back(new my_int(2));
+    vec.emplace_back();
+    vec.emplace_back();
+    vec.back().emplace_back(new my_int(3));
+    vec.emplace_back();
+
+    auto flattened = sl::ranges::flatten(std::move(vec));
+    auto res = std::vector<int>();
+    for (auto&& el : flattened) {
+        res.push_back(el->get_int());
+    }
+    slassert(3 == res.size());
+    slassert(1 == res[0]);
+    slassert(2 == res[1]);
+    slassert(3 == res[2]);
+
+    auto empty = std::vector<std::vector<int>>();
+    empty.emplace_back();
+    auto count = 0;
+    for (auto el : sl::ranges::flatten(std::move(empty))) {
+        (void) el;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_one_to_many() {
+    auto lines = std::vector<std::string>{"a b", "", "c d e"};
+    auto words = sl::ranges::flatten(sl::ranges::transform(lines, [](std::string& line) {
+        auto res = std::list<my_movable_str>();
+        std::string word;
+        for (char ch : line) {
+            if (' ' == ch) {
+                res.emplace_back(word);
+                word.clear();
+            } else {
+                word.push_back(ch);
+            }
+        }
+        if (!word.empty()) {
+            res.emplace_back(word);
+        }
+        return res;
+    }));
+    auto res = words.to_vector();
+    slassert(5 == res.size());
+    slassert("a" == res[0].get_val());
+    slassert("e" == res[4].get_val());
+}
+
+void test_lvalue() {
+    auto vec = std::vector<std::vector<my_movable>>();
+    vec.emplace_back();
+    vec.back().emplace_back(1);
+    vec.emplace_back();
+    vec.back().emplace_back(2);
+    vec.back().emplace_back(3);
+
+    auto flattened = sl::ranges::flatten(vec);
+    auto res = std::vector<int>();
+    for (auto el : flattened) {
+        res.push_back(el.get().get_val());
+    }
+    slassert(3 == res.size());
+    slassert(3 == res[2]);
+    // elements are taken by reference
+    slassert(2 == vec[1][0].get_val());
+
+    const auto& cvec = vec;
+    auto cflattened = sl::ranges::flatten(cvec);
+    auto cres = cflattened.to_vector();
+    slassert(3 == cres.size());
+    slassert(1 == cres[0].get().get_val());
+
+    auto alloc = my_counting_allocator<char>();
+    auto ares = sl::ranges::flatten(std::vector<std::vector<int>>{{1}, {2, 3}}).to_vector(alloc);
+    slassert(3 == ares.size());
+    slassert(3 == ares[2]);
+    slassert(*alloc.allocations > 0);
+}
+
+void test_fused() {
+    auto vec = std::vector<std::vector<my_movable>>();
+    for (int i = 0; i < 3; i++) {
+        vec.emplace_back();
+        for (int j = 0; j < 3; j++) {
+            vec.back().emplace_back(i * 3 + j);
+        }
+    }
+    auto filtered = sl::ranges::filter(sl::ranges::flatten(std::move(vec)), [](my_movable& el) {
+        return 1 == el.get_val() % 2;
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(filtered));
+    slassert(4 == res.size());
+    slassert(7 == res[3].get_val());
+
+    auto vec2 = std::vector<std::vector<int>>{{1, 2}, {3, 4}};
+    auto flattened = sl::ranges::flatten(std::move(vec2));
+    slassert(sl::ranges::any(flattened, [](int el) {
+        return 3 == el;
+    }));
+}
+
+int main() {
+    try {
+        test_owned();
+        test_one_to_many();
+        test_lvalue();
+        test_fused();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   fusion_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 1:40 PM
+ */
+
+#include "staticlib/ranges/fusion.hpp"
+
+#include <iostream>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/ranges/concat.hpp"
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+class collecting_sink {
+    std::vector<int>& dest;
+    size_t limit;
+
+public:
+    collecting_sink(std::vector<int>& dest, size_t limit) :
+    dest(dest),
+    limit(limit) { }
+
+    bool operator()(my_movable&& el) {
+        dest.push_back(el.get_val());
+        return dest.size() < limit;
+    }
+};
+
+void test_nested() {
+    auto vec = std::vector<std::unique_ptr<my_int>>{};
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(new my_int(i));
+    }
+    int transformed_count = 0;
+    int filtered_count = 0;
+    auto offcasted = std::vector<std::unique_ptr<my_str>>{};
+    auto range = sl::ranges::transform(
+        sl::ranges::filter(
+            sl::ranges::transform(std::move(vec), [&transformed_count](std::unique_ptr<my_int> el) {
+                transformed_count += 1;
+                return std::unique_ptr<my_str>(new my_str(sl::support::to_string(el->get_int())));
+            }), [&filtered_count](std::unique_ptr<my_str>& el) {
+                filtered_count += 1;
+                return "3" != el->get_str() && "7" != el->get_str();
+            }, sl::ranges::offcast_into(offcasted)),
+        [](std::unique_ptr<my_str> el) {
+            return el->get_str() + "_42";
+        });
+    auto res = range.to_vector();
+
+    slassert(10 == transformed_count);
+    slassert(10 == filtered_count);
+    slassert(8 == res.size());
+    slassert("0_42" == res[0]);
+    slassert("2_42" == res[2]);
+    slassert("4_42" == res[3]);
+    slassert("9_42" == res[7]);
+    slassert(2 == offcasted.size());
+    slassert("3" == offcasted[0]->get_str());
+    slassert("7" == offcasted[1]->get_str());
+}
+
+void test_short_circuit() {
+    auto vec = std::vector<my_movable>{};
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(i);
+    }
+    int count = 0;
+    auto transformed = sl::ranges::transform(vec, [&count](my_movable& el) {
+        count += 1;
+        return el.get_val();
+    });
+    bool res = sl::ranges::any(transformed, [](int el) {
+        return 3 == el;
+    });
+    slassert(res);
+    slassert(4 == count);
+}
+
+void test_sink() {
+    auto transformed = sl::ranges::transform(my_counting_range(5), [](my_movable el) {
+        el.set_val(el.get_val() * 10);
+        return el;
+    });
+    auto dest = std::vector<int>();
+    auto sink = collecting_sink(dest, 3);
+    bool completed = sl::ranges::fused_for_each(transformed, sink);
+    slassert(!completed);
+    slassert(3 == dest.size());
+    slassert(10 == dest[0]);
+    slassert(20 == dest[1]);
+    slassert(30 == dest[2]);
+}
+
+void test_concat() {
+    auto vec = std::vector<my_movable>{};
+    vec.emplace_back(1);
+    auto li = std::list<my_movable>{};
+    li.emplace_back(2);
+    li.emplace_back(3);
+    auto range = sl::ranges::concat(std::move(vec), sl::ranges::concat(std::move(li), my_counting_range(2)));
+    auto res = range.to_vector();
+    slassert(5 == res.size());
+    slassert(1 == res[0].get_val());
+    slassert(3 == res[2].get_val());
+    slassert(1 == res[3].get_val());
+    slassert(2 == res[4].get_val());
+}
+
+int main() {
+    try {
+        test_nested();
+        test_short_circuit();
+        test_sink();
+        test_concat();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   generator_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 9:55 PM
+ */
+
+#include "staticlib/ranges/generator.hpp"
+
+#include <iostream>
+
+#ifdef STATICLIB_RANGES_COROUTINES
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/concat.hpp"
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+namespace sr = staticlib::ranges;
+
+sr::generator<int> iota(int from, int to) {
+    for (int i = from; i < to; i++) {
+        co_yield i;
+    }
+}
+
+sr::generator<std::unique_ptr<my_int>> owned(int count) {
+    for (int i = 0; i < count; i++) {
+        co_yield std::unique_ptr<my_int>(new my_int(i));
+    }
+}
+
+sr::generator<std::string> copied(const std::vector<std::string>& vec) {
+    for (auto& st : vec) {
+        auto el = st + "_";
+        co_yield el;
+        // lvalue is copied, original is not moved from
+        slassert(st + "_" == el);
+    }
+}
+
+sr::generator<int> failing(int count) {
+    for (int i = 0; i < count; i++) {
+        co_yield i;
+    }
+    throw std::runtime_error("generator failure");
+}
+
+void test_iterate() {
+    auto res = std::vector<int>();
+    for (int el : iota(0, 5)) {
+        res.push_back(el);
+    }
+    slassert(5 == res.size());
+    slassert(0 == res[0]);
+    slassert(4 == res[4]);
+
+    auto count = 0;
+    for (int el : iota(0, 0)) {
+        (void) el;
+        count += 1;
+    }
+    slassert(0 == count);
+
+    auto gen = iota(0, 3);
+    auto it = gen.begin();
+    (void) it;
+    bool thrown = false;
+    try {
+        gen.begin();
+    } catch (const std::range_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_move_only() {
+    auto res = std::vector<std::unique_ptr<my_int>>();
+    for (auto&& el : owned(3)) {
+        res.push_back(std::move(el));
+    }
+    slassert(3 == res.size());
+    slassert(2 == res[2]->get_int());
+
+    auto strs = std::vector<std::string>{"foo", "bar"};
+    auto cres = sr::emplace_to_vector(copied(strs));
+    slassert(2 == cres.size());
+    slassert("bar_" == cres[1]);
+}
+
+void test_pipeline() {
+    auto transformed = sr::transform(owned(10), [](std::unique_ptr<my_int> el) {
+        return el->get_int();
+    });
+    auto filtered = sr::filter(std::move(transformed), [](int el) {
+        return 0 == el % 2;
+    });
+    auto concatted = sr::concat(std::move(filtered), iota(100, 102));
+    auto res = sr::emplace_to_vector(std::move(concatted));
+    slassert(7 == res.size());
+    slassert(0 == res[0]);
+    slassert(8 == res[4]);
+    slassert(101 == res[6]);
+}
+
+void test_exception() {
+    auto res = std::vector<int>();
+    bool thrown = false;
+    try {
+        for (int el : failing(3)) {
+            res.push_back(el);
+        }
+    } catch (const std::runtime_error& e) {
+        thrown = true;
+        slassert(std::string("generator failure") == e.what());
+    }
+    slassert(thrown);
+    slassert(3 == res.size());
+}
+
+void test_early_destroy() {
+    for (int i = 0; i < 100; i++) {
+        auto gen = owned(10);
+        auto it = gen.begin();
+        slassert(0 == (*it)->get_int());
+        // frame and suspended element are destroyed with generator
+    }
+}
+
+void test_other_thread() {
+    // created here, iterated and destroyed on another thread
+    auto gen = std::unique_ptr<sr::generator<int>>(new sr::generator<int>(iota(0, 10)));
+    int sum = 0;
+    auto th = std::thread([&gen, &sum] {
+        for (auto el : *gen) {
+            sum += el;
+        }
+        gen.reset();
+    });
+    th.join();
+    slassert(45 == sum);
+
+    // created on another thread, destroyed here
+    auto moved = std::unique_ptr<sr::generator<int>>();
+    auto th2 = std::thread([&moved] {
+        moved.reset(new sr::generator<int>(iota(0, 3)));
+    });
+    th2.join();
+    auto res = std::vector<int>();
+    for (auto el : *moved) {
+        res.push_back(el);
+    }
+    moved.reset();
+    slassert(3 == res.size());
+}
+
+void test_after_pool_destroyed() {
+    auto th = std::thread([] {
+        // constructed before the pool, so destroyed after it on thread exit
+        static thread_local std::unique_ptr<sr::generator<int>> holder;
+        holder.reset(new sr::generator<int>(iota(0, 3)));
+        slassert(0 == *holder->begin());
+    });
+    th.join();
+}
+
+int main() {
+    try {
+        test_iterate();
+        test_move_only();
+        test_pipeline();
+        test_exception();
+        test_early_destroy();
+        test_other_thread();
+        test_after_pool_destroyed();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#else // STATICLIB_RANGES_COROUTINES
+
+int main() {
+    std::cout << "C++20 coroutines are not supported, generator tests skipped" << std::endl;
+    return 0;
+}
+
+#endif // STATICLIB_RANGES_COROUTINES
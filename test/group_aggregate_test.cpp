@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   group_aggregate_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 9:50 AM
+ */
+
+#include "staticlib/ranges/group_aggregate.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_sum_by_key() {
+    auto vec = std::vector<std::pair<std::string, int>>();
+    vec.emplace_back("foo", 1);
+    vec.emplace_back("bar", 2);
+    vec.emplace_back("foo", 3);
+    vec.emplace_back("baz", 4);
+    vec.emplace_back("bar", 5);
+    auto res = sl::ranges::group_aggregate(vec, [](const std::pair<std::string, int>& el) {
+        return el.first;
+    }, 0, [](int acc, const std::pair<std::string, int>& el) {
+        return acc + el.second;
+    });
+    slassert(3 == res.size());
+    slassert(4 == res.find("foo")->second);
+    slassert(7 == res.find("bar")->second);
+    slassert(4 == res.find("baz")->second);
+}
+
+void test_movable() {
+    // move-only elements are moved into aggregation function
+    auto src = my_counting_range(100);
+    auto filtered = sl::ranges::filter(std::move(src), [](const my_movable& el) {
+        return 0 != el.get_val() % 10;
+    });
+    auto res = sl::ranges::group_aggregate(filtered, [](const my_movable& el) {
+        return el.get_val() % 3;
+    }, std::vector<int>(), [](std::vector<int> acc, my_movable el) {
+        my_movable moved = std::move(el);
+        acc.push_back(moved.get_val());
+        return acc;
+    }, 3);
+    slassert(3 == res.size());
+    std::size_t total = 0;
+    for (auto& en : res) {
+        for (int val : en.second) {
+            slassert(en.first == val % 3);
+        }
+        total += en.second.size();
+    }
+    slassert(90 == total);
+    auto& zeros = res.find(0)->second;
+    slassert(3 == zeros.front());
+    slassert(99 == zeros.back());
+}
+
+void test_cardinality() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 10000; i++) {
+        vec.push_back(i);
+    }
+    auto range = sl::ranges::transform(vec, [](int el) {
+        return el * 2;
+    });
+    auto res = sl::ranges::group_aggregate(range, [](int el) {
+        return el % 1000;
+    }, 0, [](int acc, int) {
+        return acc + 1;
+    }, 500);
+    slassert(500 == res.size());
+    for (auto& en : res) {
+        slassert(0 == en.first % 2);
+        slassert(20 == en.second);
+    }
+}
+
+void test_cardinality_too_large() {
+    auto vec = std::vector<int>{1, 2, 3};
+    bool thrown = false;
+    try {
+        sl::ranges::group_aggregate(vec, [](int el) {
+            return el;
+        }, 0, [](int acc, int) {
+            return acc + 1;
+        }, static_cast<std::size_t>(-1));
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_sum_by_key();
+        test_movable();
+        test_cardinality();
+        test_cardinality_too_large();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   join_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 3:40 PM
+ */
+
+#include "staticlib/ranges/join.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/fd_records.hpp"
+#include "staticlib/ranges/parallel.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+struct user {
+    int id;
+    std::string name;
+
+    user(int id, std::string name) :
+    id(id),
+    name(std::move(name)) { }
+};
+
+struct event {
+    int user_id;
+    std::string action;
+
+    event(int user_id, std::string action) :
+    user_id(user_id),
+    action(std::move(action)) { }
+};
+
+std::vector<user> users() {
+    auto vec = std::vector<user>();
+    vec.emplace_back(1, "foo");
+    vec.emplace_back(2, "bar");
+    vec.emplace_back(3, "baz");
+    // duplicate key
+    vec.emplace_back(1, "foo2");
+    return vec;
+}
+
+std::vector<event> events() {
+    auto vec = std::vector<event>();
+    vec.emplace_back(2, "login");
+    vec.emplace_back(4, "login");
+    vec.emplace_back(1, "click");
+    vec.emplace_back(2, "logout");
+    return vec;
+}
+
+void test_hash_join() {
+    auto us = users();
+    auto joined = sl::ranges::hash_join(us, events(), [](const user& el) {
+        return el.id;
+    }, [](const event& el) {
+        return el.user_id;
+    }, [](const user& u, const event& ev) {
+        return u.name + ":" + ev.action;
+    });
+    auto res = std::vector<std::string>();
+    for (auto el : joined) {
+        res.push_back(std::move(el));
+    }
+    auto expected = std::vector<std::string>{"bar:login", "foo:click", "foo2:click", "bar:logout"};
+    slassert(expected == res);
+    // build side taken by reference
+    slassert("foo" == us[0].name);
+}
+
+void test_hash_join_movable() {
+    // move-only build and probe elements, results are moved out
+    auto build = sl::ranges::transform(std::vector<int>{1, 2, 3}, [](int el) {
+        return my_movable(el);
+    });
+    auto probe = sl::ranges::transform(std::vector<int>{3, 3, 5, 1}, [](int el) {
+        return my_movable(el);
+    });
+    auto joined = sl::ranges::hash_join(std::move(build), std::move(probe), [](const my_movable& el) {
+        return el.get_val();
+    }, [](const my_movable& el) {
+        return el.get_val();
+    }, [](my_movable& b, my_movable& p) {
+        return my_movable(b.get_val() * 10 + p.get_val());
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(joined));
+    slassert(3 == res.size());
+    slassert(33 == res[0].get_val());
+    slassert(33 == res[1].get_val());
+    slassert(11 == res[2].get_val());
+}
+
+void test_hash_join_fused() {
+    auto joined = sl::ranges::hash_join(users(), events(), [](const user& el) {
+        return el.id;
+    }, [](const event& el) {
+        return el.user_id;
+    }, [](const user& u, const event&) {
+        return u.name;
+    });
+    slassert(4 == sl::ranges::count(joined));
+}
+
+void test_hash_join_records() {
+    // probe views point into the source buffer, that is reused on the next read
+    auto build = std::vector<std::string>();
+    auto data = std::string();
+    for (int i = 0; i < 50; i++) {
+        build.push_back("record_" + std::to_string(i));
+        data += build.back() + "\n";
+    }
+    int fds[2];
+    slassert(0 == ::pipe(fds));
+    slassert(static_cast<ssize_t>(data.size()) == ::write(fds[1], data.data(), data.size()));
+    ::close(fds[1]);
+    auto joined = sl::ranges::hash_join(build, sl::ranges::fd_records(fds[0], '\n', 16),
+            [](const std::string& el) {
+        return el;
+    }, [](const sl::ranges::record_view& rec) {
+        return rec.str();
+    }, [](const std::string& b, const sl::ranges::record_view& rec) {
+        return b + "=" + rec.str();
+    });
+    auto res = std::vector<std::string>();
+    for (auto el : joined) {
+        res.push_back(std::move(el));
+    }
+    ::close(fds[0]);
+    slassert(50 == res.size());
+    for (std::size_t i = 0; i < res.size(); i++) {
+        slassert(build[i] + "=" + build[i] == res[i]);
+    }
+}
+
+void test_semi_join() {
+    auto dropped = std::vector<std::string>();
+    auto matched = sl::ranges::semi_join(users(), events(), [](const user& el) {
+        return el.id;
+    }, [](const event& el) {
+        return el.user_id;
+    }, [&dropped](event el) {
+        dropped.push_back(el.action);
+    });
+    auto res = std::vector<int>();
+    for (auto el : matched) {
+        res.push_back(el.user_id);
+    }
+    slassert(3 == res.size());
+    slassert(2 == res[0]);
+    slassert(1 == res[1]);
+    slassert(2 == res[2]);
+    slassert(1 == dropped.size());
+    slassert("login" == dropped[0]);
+}
+
+void test_anti_join() {
+    auto evs = events();
+    auto unmatched = sl::ranges::anti_join(users(), evs, [](const user& el) {
+        return el.id;
+    }, [](const event& el) {
+        return el.user_id;
+    });
+    auto res = std::vector<int>();
+    for (auto el : unmatched) {
+        res.push_back(el.get().user_id);
+    }
+    slassert(1 == res.size());
+    slassert(4 == res[0]);
+}
+
+void test_semi_join_parallel() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 100000; i++) {
+        vec.push_back(i);
+    }
+    auto odd = std::vector<int>();
+    for (int i = 1; i < 1000; i += 2) {
+        odd.push_back(i);
+    }
+    auto matched = sl::ranges::semi_join(odd, vec, [](int el) {
+        return el;
+    }, [](int el) {
+        return el % 1000;
+    });
+    auto res = matched.to_vector(sl::ranges::parallel_policy(4, 1024));
+    slassert(50000 == res.size());
+    slassert(1 == res[0].get());
+    slassert(99999 == res.back().get());
+}
+
+int main() {
+    try {
+        test_hash_join();
+        test_hash_join_movable();
+        test_hash_join_fused();
+        test_hash_join_records();
+        test_semi_join();
+        test_anti_join();
+        test_semi_join_parallel();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   mapped_records_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 11:40 PM
+ */
+
+#include "staticlib/ranges/mapped_records.hpp"
+
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+const std::string test_file = "mapped_records_test.txt";
+
+void write_file(const std::string& contents) {
+    std::ofstream stream(test_file, std::ios::binary | std::ios::trunc);
+    stream << contents;
+}
+
+void test_lines() {
+    write_file("foo\n\nbar\nbaz");
+    auto res = std::vector<std::string>();
+    for (auto rec : sl::ranges::mapped_records(test_file)) {
+        res.push_back(rec.str());
+    }
+    slassert(4 == res.size());
+    slassert("foo" == res[0]);
+    slassert("" == res[1]);
+    slassert("bar" == res[2]);
+    slassert("baz" == res[3]);
+
+    // trailing delimiter does not produce empty record
+    write_file("a;b;");
+    // views remain valid while the range is alive
+    auto mapped = sl::ranges::mapped_records(test_file, ';');
+    auto recs = std::vector<sl::ranges::record_view>();
+    for (auto rec : mapped) {
+        recs.push_back(rec);
+    }
+    slassert(2 == recs.size());
+    slassert(recs[1] == std::string("b"));
+
+    write_file("");
+    auto count = 0;
+    for (auto rec : sl::ranges::mapped_records(test_file)) {
+        (void) rec;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_window() {
+    // lines crossing window boundaries and lines longer than window
+    auto contents = std::string();
+    auto expected = std::vector<std::string>();
+    for (int i = 0; i < 3000; i++) {
+        auto line = std::string(static_cast<std::size_t>((i * 37) % 300), static_cast<char>('a' + i % 26));
+        if (0 == i % 1000) {
+            line = std::string(20000, 'x');
+        }
+        contents += line;
+        contents += '\n';
+        expected.push_back(line);
+    }
+    write_file(contents);
+    auto res = std::vector<std::string>();
+    for (auto rec : sl::ranges::mapped_records(test_file, '\n', 4096)) {
+        res.push_back(rec.str());
+    }
+    slassert(expected == res);
+}
+
+void test_fused() {
+    write_file("INFO start\nERROR disk\nINFO work\nERROR net\n");
+    auto errors = sl::ranges::transform(sl::ranges::filter(sl::ranges::mapped_records(test_file, '\n', 1),
+            [](const sl::ranges::record_view& rec) {
+        return rec.size() >= 5 && 0 == rec.str().compare(0, 5, "ERROR");
+    }), [](sl::ranges::record_view rec) {
+        return rec.str();
+    });
+    auto res = errors.to_vector();
+    slassert(2 == res.size());
+    slassert("ERROR disk" == res[0]);
+    slassert("ERROR net" == res[1]);
+}
+
+void test_error() {
+    bool thrown = false;
+    try {
+        auto recs = sl::ranges::mapped_records("mapped_records_test_nonexistent.txt");
+        (void) recs;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_lines();
+        test_window();
+        test_fused();
+        test_error();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        std::remove(test_file.c_str());
+        return 1;
+    }
+    std::remove(test_file.c_str());
+    return 0;
+}
+
+#else // POSIX
+
+int main() {
+    std::cout << "Memory-mapped sources are not supported on this platform" << std::endl;
+    return 0;
+}
+
+#endif // POSIX
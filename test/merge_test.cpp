@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   merge_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 11:30 AM
+ */
+
+#include "staticlib/ranges/merge.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+// yields `from, from + step, ...` values less than `max`
+class stepping_range : public sl::ranges::range_adapter<stepping_range, my_movable> {
+    int val;
+    int step;
+    int max;
+
+public:
+    stepping_range(int from, int step, int max) :
+    val(from),
+    step(step),
+    max(max) { }
+
+    stepping_range(stepping_range&& other) :
+    sl::ranges::range_adapter<stepping_range, my_movable>(std::move(other)),
+    val(other.val),
+    step(other.step),
+    max(other.max) { }
+
+    bool compute_next() {
+        if (val < max) {
+            int cur = val;
+            val += step;
+            return this->set_current(my_movable(cur));
+        }
+        return false;
+    }
+};
+
+bool less_movable(const my_movable& a, const my_movable& b) {
+    return a.get_val() < b.get_val();
+}
+
+void test_variadic() {
+    auto vec1 = std::vector<int>{1, 4, 7, 10};
+    auto vec2 = std::vector<int>{2, 3, 8};
+    auto vec3 = std::vector<int>();
+    auto merged = sl::ranges::merge([](int a, int b) {
+        return a < b;
+    }, std::move(vec1), std::move(vec2), std::move(vec3), std::vector<int>{0, 5, 6, 9, 11});
+    slassert(12 == merged.get_size_hint().value());
+    auto res = std::vector<int>();
+    for (int el : merged) {
+        res.push_back(el);
+    }
+    slassert(12 == res.size());
+    for (int i = 0; i < 12; i++) {
+        slassert(i == res[i]);
+    }
+
+    // sources of different types
+    auto mixed = sl::ranges::merge([](int a, int b) {
+        return a < b;
+    }, std::vector<int>{1, 3}, std::list<int>{0, 2, 4});
+    slassert(5 == mixed.get_size_hint().value());
+    auto mixed_res = sl::ranges::emplace_to_vector(std::move(mixed));
+    auto expected = std::vector<int>{0, 1, 2, 3, 4};
+    slassert(expected == mixed_res);
+}
+
+void test_movable() {
+    auto merged = sl::ranges::merge(less_movable,
+            stepping_range(0, 3, 30), stepping_range(1, 3, 30), stepping_range(2, 3, 15));
+    auto vals = sl::ranges::transform(std::move(merged), [](my_movable el) {
+        return el.get_val();
+    });
+    auto res = vals.to_vector();
+    slassert(25 == res.size());
+    for (int i = 0; i < 15; i++) {
+        slassert(i == res[i]);
+    }
+    slassert(15 == res[15]);
+    slassert(16 == res[16]);
+    slassert(28 == res.back());
+}
+
+void test_stable() {
+    using pair_type = std::pair<int, std::string>;
+    auto vec1 = std::vector<pair_type>{pair_type(1, "a1"), pair_type(2, "a2"), pair_type(2, "a3")};
+    auto vec2 = std::vector<pair_type>{pair_type(1, "b1"), pair_type(2, "b2")};
+    auto vec3 = std::vector<pair_type>{pair_type(0, "c0"), pair_type(2, "c2")};
+    auto merged = sl::ranges::merge([](const pair_type& a, const pair_type& b) {
+        return a.first < b.first;
+    }, vec1, vec2, vec3);
+    auto res = std::vector<std::string>();
+    for (auto el : merged) {
+        res.push_back(el.get().second);
+    }
+    auto expected = std::vector<std::string>{"c0", "a1", "b1", "a2", "a3", "b2", "c2"};
+    slassert(expected == res);
+    // lvalue sources are not moved from
+    slassert("a1" == vec1[0].second);
+}
+
+void test_runtime() {
+    auto shards = std::vector<stepping_range>();
+    for (int i = 0; i < 13; i++) {
+        shards.emplace_back(i, 13, 1000);
+    }
+    auto merged = sl::ranges::merge_all(less_movable, std::move(shards));
+    int expected = 0;
+    for (auto el : merged) {
+        slassert(expected == el.get_val());
+        expected += 1;
+    }
+    slassert(1000 == expected);
+
+    auto empty = sl::ranges::merge_all(less_movable, std::vector<stepping_range>());
+    slassert(!sl::ranges::any(empty, [](const my_movable&) {
+        return true;
+    }));
+}
+
+void test_fused() {
+    auto shards = std::vector<stepping_range>();
+    shards.emplace_back(0, 2, 100);
+    shards.emplace_back(1, 2, 100);
+    auto merged = sl::ranges::merge_all(less_movable, std::move(shards));
+    auto found = sl::ranges::find(merged, [](const my_movable& el) {
+        return el.get_val() > 41;
+    }, my_movable(-1));
+    slassert(42 == found.get_val());
+    // iteration continues after the stop
+    auto next = sl::ranges::find(merged, [](const my_movable&) {
+        return true;
+    }, my_movable(-1));
+    slassert(43 == next.get_val());
+}
+
+int main() {
+    try {
+        test_variadic();
+        test_movable();
+        test_stable();
+        test_runtime();
+        test_fused();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,337 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parallel_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 3:55 PM
+ */
+
+#include "staticlib/ranges/parallel.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+const sl::ranges::parallel_policy policy{4, 10};
+
+void test_transform() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 0; i < 1000; i++) {
+        vec.emplace_back(i);
+    }
+    std::atomic<int> count{0};
+    auto transformed = sl::ranges::transform(vec, [&count](my_movable& el) {
+        count += 1;
+        return el.get_val() * 2;
+    });
+    auto res = transformed.to_vector(policy);
+    slassert(1000 == count);
+    slassert(1000 == res.size());
+    for (int i = 0; i < 1000; i++) {
+        slassert(i * 2 == res[i]);
+    }
+}
+
+void test_transform_movable() {
+    auto vec = std::vector<std::unique_ptr<my_int>>();
+    for (int i = 0; i < 100; i++) {
+        vec.emplace_back(new my_int(i));
+    }
+    auto transformed = sl::ranges::transform(std::move(vec), [](std::unique_ptr<my_int> el) {
+        return my_movable_str(sl::support::to_string(el->get_int()));
+    });
+    auto res = transformed.to_vector(policy);
+    slassert(100 == res.size());
+    slassert("0" == res[0].get_val());
+    slassert("42" == res[42].get_val());
+    slassert("99" == res[99].get_val());
+}
+
+void test_filter() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 0; i < 1000; i++) {
+        vec.emplace_back(i);
+    }
+    auto transformed = sl::ranges::transform(vec, [](my_movable& el) {
+        return my_movable(el.get_val() + 1);
+    });
+    auto filtered = sl::ranges::filter(std::move(transformed), [](my_movable& el) {
+        return 0 == el.get_val() % 3;
+    });
+    auto res = filtered.to_vector(policy);
+    slassert(333 == res.size());
+    for (int i = 0; i < 333; i++) {
+        slassert((i + 1) * 3 == res[i].get_val());
+    }
+}
+
+void test_offcast_batch() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    auto offs = std::vector<int>();
+    auto filtered = sl::ranges::filter(std::move(vec), [](int el) {
+        return 0 == el % 2;
+    }, sl::ranges::offcast_batch<std::vector<int>>(offs));
+    static_assert(!sl::ranges::detail_fusion::is_sliceable<decltype(filtered)>::value, "sequential");
+    auto res = filtered.to_vector(policy);
+    slassert(500 == res.size());
+    slassert(998 == res[499]);
+    // delivered on exhaustion, before the range is destroyed
+    slassert(500 == offs.size());
+    slassert(1 == offs[0]);
+    slassert(999 == offs[499]);
+}
+
+void test_offcast_into() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    auto offs = std::vector<int>();
+    auto filtered = sl::ranges::filter(std::move(vec), [](int el) {
+        return 0 == el % 2;
+    }, sl::ranges::offcast_into(offs));
+    static_assert(!sl::ranges::detail_fusion::is_sliceable<decltype(filtered)>::value, "sequential");
+    auto res = filtered.to_vector(policy);
+    slassert(500 == res.size());
+    slassert(500 == offs.size());
+    for (int i = 0; i < 500; i++) {
+        slassert(i * 2 == res[i]);
+        slassert(i * 2 + 1 == offs[i]);
+    }
+
+    // stateless offcasts are still processed in parallel
+    auto ints = std::vector<int>{1, 2, 3};
+    auto ignored = sl::ranges::filter(std::move(ints), [](int el) {
+        return el > 1;
+    }, sl::ranges::ignore_offcast<int>);
+    static_assert(sl::ranges::detail_fusion::is_sliceable<decltype(ignored)>::value, "parallel");
+}
+
+void test_sequential_fallback() {
+    auto li = std::list<my_movable>();
+    for (int i = 0; i < 100; i++) {
+        li.emplace_back(i);
+    }
+    auto transformed = sl::ranges::transform(li, [](my_movable& el) {
+        return el.get_val();
+    });
+    auto res = transformed.to_vector(policy);
+    slassert(100 == res.size());
+    slassert(99 == res[99]);
+}
+
+void test_exception() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    auto transformed = sl::ranges::transform(vec, [](int& el) {
+        if (777 == el) {
+            throw std::runtime_error("fail");
+        }
+        return el;
+    });
+    bool thrown = false;
+    try {
+        transformed.to_vector(policy);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_reductions() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i % 100);
+    }
+    auto transformed = sl::ranges::transform(vec, [](int el) {
+        return static_cast<long>(el) * 2;
+    });
+    slassert(99000 == sl::ranges::sum(policy, transformed));
+    slassert(99000 == sl::ranges::sum(transformed));
+    auto filtered = sl::ranges::filter(vec, [](int el) {
+        return el < 10;
+    });
+    slassert(100 == sl::ranges::count(policy, filtered));
+    slassert(1000 == sl::ranges::count(policy, vec));
+    slassert(10 == sl::ranges::count(policy, vec, [](int el) {
+        return 42 == el;
+    }));
+
+    // combiner is applied in order, only associativity is required
+    auto digits = sl::ranges::transform(vec, [](int el) {
+        return el % 10;
+    });
+    auto concatenated = sl::ranges::fold(policy, digits, std::string(), [](std::string&& acc, int el) {
+        return acc + static_cast<char>('0' + el);
+    }, [](std::string&& a, std::string&& b) {
+        return a + b;
+    });
+    slassert(1000 == concatenated.size());
+    slassert("0123456789" == concatenated.substr(0, 10));
+    slassert("0123456789" == concatenated.substr(990, 10));
+
+    // the first of equal elements is returned
+    auto indexed = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < 1000; i++) {
+        indexed.emplace_back(i % 100, i);
+    }
+    auto by_first = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+    };
+    auto rindexed = sl::ranges::transform(indexed, [](const std::pair<int, int>& el) {
+        return el;
+    });
+    slassert(0 == sl::ranges::min_element(policy, rindexed, std::make_pair(-1, -1), by_first).second);
+    slassert(99 == sl::ranges::max_element(policy, rindexed, std::make_pair(-1, -1), by_first).second);
+    auto empty = std::vector<int>();
+    slassert(-1 == sl::ranges::min_element(policy, empty, -1));
+    slassert(99 == sl::ranges::max_element(policy, vec, -1));
+
+    // elements of the containers are not moved from
+    auto strings = std::vector<std::string>();
+    for (int i = 0; i < 1000; i++) {
+        strings.push_back(sl::support::to_string(i % 100) + "_long_enough_to_be_allocated");
+    }
+    auto strings_copy = strings;
+    slassert(1000 == sl::ranges::count(policy, strings));
+    slassert(10 == sl::ranges::count(policy, strings, [](const std::string& el) {
+        return '7' == el[0] && '_' == el[1];
+    }));
+    slassert("0_long_enough_to_be_allocated" == sl::ranges::min_element(policy, strings, std::string()));
+    slassert("9_long_enough_to_be_allocated" == sl::ranges::max_element(policy, strings, std::string()));
+    slassert(strings_copy == strings);
+
+    // sequential fallback
+    auto lst = std::list<int>{1, 2, 3};
+    slassert(6 == sl::ranges::sum(policy, lst));
+    slassert(3 == sl::ranges::max_element(policy, lst, -1));
+}
+
+void test_find() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 10000; i++) {
+        vec.push_back(i % 1000);
+    }
+    std::atomic<int> checked(0);
+    auto pred = [&checked](int el) {
+        checked.fetch_add(1);
+        return 500 == el;
+    };
+    slassert(sl::ranges::any(policy, vec, pred));
+    // stopped early
+    slassert(checked.load() < 10000);
+    slassert(!sl::ranges::any(policy, vec, [](int el) {
+        return el < 0;
+    }));
+
+    auto indexed = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < 10000; i++) {
+        indexed.emplace_back(i % 1000, i);
+    }
+    auto transformed = sl::ranges::transform(indexed, [](const std::pair<int, int>& el) {
+        return el;
+    });
+    auto is_500 = [](const std::pair<int, int>& el) {
+        return 500 == el.first;
+    };
+    // the first match in order
+    for (int i = 0; i < 10; i++) {
+        auto res = sl::ranges::find(policy, transformed, is_500, std::make_pair(-1, -1));
+        slassert(500 == res.second);
+    }
+    // any match
+    auto res = sl::ranges::find(policy, transformed, is_500, std::make_pair(-1, -1), false);
+    slassert(500 == res.first);
+    slassert(500 == res.second % 1000);
+    auto none = sl::ranges::find(policy, transformed, [](const std::pair<int, int>& el) {
+        return el.first < 0;
+    }, std::make_pair(-1, -1));
+    slassert(-1 == none.second);
+
+    // move-only elements
+    auto movables = std::vector<my_movable>();
+    for (int i = 0; i < 1000; i++) {
+        movables.emplace_back(i);
+    }
+    auto refs = sl::ranges::transform(movables, [](my_movable& el) {
+        return my_movable(el.get_val());
+    });
+    auto found = sl::ranges::find(policy, refs, [](my_movable& el) {
+        return 0 == el.get_val() % 7 && el.get_val() > 0;
+    }, my_movable(-1));
+    slassert(7 == found.get_val());
+
+    // sequential fallback
+    auto lst = std::list<int>{1, 2, 3};
+    slassert(sl::ranges::any(policy, lst, [](int el) {
+        return 2 == el;
+    }));
+    slassert(3 == sl::ranges::find(policy, lst, [](int el) {
+        return el > 2;
+    }, -1));
+
+    // exceptions are propagated
+    bool thrown = false;
+    try {
+        sl::ranges::any(policy, vec, [](int el) -> bool {
+            if (700 == el) {
+                throw std::runtime_error("fail");
+            }
+            return false;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_transform();
+        test_transform_movable();
+        test_filter();
+        test_offcast_batch();
+        test_offcast_into();
+        test_sequential_fallback();
+        test_exception();
+        test_reductions();
+        test_find();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
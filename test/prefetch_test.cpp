@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   prefetch_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 9:10 PM
+ */
+
+#include "staticlib/ranges/prefetch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_adapter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+class counting_range : public sl::ranges::range_adapter<counting_range, int> {
+    int count = 0;
+    int limit;
+    int throw_at;
+    int sleep_millis;
+    std::atomic<int>* produced;
+
+public:
+    counting_range(int limit, int throw_at, int sleep_millis, std::atomic<int>& produced) :
+    limit(limit),
+    throw_at(throw_at),
+    sleep_millis(sleep_millis),
+    produced(std::addressof(produced)) { }
+
+    counting_range(counting_range&& other) :
+    sl::ranges::range_adapter<counting_range, int>(std::move(other)),
+    count(other.count),
+    limit(other.limit),
+    throw_at(other.throw_at),
+    sleep_millis(other.sleep_millis),
+    produced(other.produced) { }
+
+    bool compute_next() {
+        if (count == throw_at) {
+            throw std::runtime_error("upstream failure");
+        }
+        if (count >= limit) {
+            return false;
+        }
+        if (sleep_millis > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleep_millis));
+        }
+        produced->fetch_add(1);
+        return set_current(count++);
+    }
+};
+
+void test_order() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 10000; i++) {
+        vec.push_back(i);
+    }
+    auto res = std::vector<int>();
+    for (int el : sl::ranges::prefetch(std::move(vec), 16)) {
+        res.push_back(el);
+    }
+    slassert(10000 == res.size());
+    for (int i = 0; i < 10000; i++) {
+        slassert(i == res[i]);
+    }
+
+    auto empty = std::vector<int>();
+    auto count = 0;
+    for (auto el : sl::ranges::prefetch(std::move(empty))) {
+        (void) el;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_move_only() {
+    auto vec = std::vector<std::unique_ptr<my_int>>();
+    for (int i = 0; i < 100; i++) {
+        vec.emplace_back(new my_int(i));
+    }
+    auto transformed = sl::ranges::transform(std::move(vec), [](std::unique_ptr<my_int> el) {
+        return my_movable(el->get_int() * 2);
+    });
+    auto res = sl::ranges::emplace_to_vector(sl::ranges::prefetch(std::move(transformed), 3));
+    slassert(100 == res.size());
+    slassert(0 == res[0].get_val());
+    slassert(198 == res[99].get_val());
+}
+
+void test_lvalue() {
+    auto vec = std::vector<my_movable>();
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+    vec.emplace_back(3);
+    auto prefetched = sl::ranges::prefetch(vec);
+    slassert(3 == prefetched.get_size_hint().value());
+    auto res = std::vector<int>();
+    for (auto el : prefetched) {
+        res.push_back(el.get().get_val());
+    }
+    slassert(3 == res.size());
+    slassert(3 == res[2]);
+    // elements are taken by reference
+    slassert(2 == vec[1].get_val());
+}
+
+void test_exception() {
+    std::atomic<int> produced(0);
+    auto res = std::vector<int>();
+    bool thrown = false;
+    try {
+        for (int el : sl::ranges::prefetch(counting_range(100, 42, 0, produced), 8)) {
+            res.push_back(el);
+        }
+    } catch (const std::runtime_error& e) {
+        thrown = true;
+        slassert(std::string("upstream failure") == e.what());
+    }
+    slassert(thrown);
+    // all the elements produced before failure are consumed
+    slassert(42 == res.size());
+    slassert(41 == res[41]);
+}
+
+void test_early_stop() {
+    std::atomic<int> produced(0);
+    {
+        auto prefetched = sl::ranges::prefetch(counting_range(1000000, -1, 0, produced), 4);
+        auto count = 0;
+        for (int el : prefetched) {
+            (void) el;
+            count += 1;
+            if (10 == count) {
+                break;
+            }
+        }
+        slassert(10 == count);
+    }
+    // producer is joined, it could not run ahead more than capacity
+    slassert(produced.load() <= 10 + 4 + 1);
+
+    // not started
+    auto unused = sl::ranges::prefetch(counting_range(10, -1, 0, produced));
+    (void) unused;
+}
+
+void test_slow_producer() {
+    std::atomic<int> produced(0);
+    auto filtered = sl::ranges::filter(counting_range(5, -1, 3, produced), [](int el) {
+        return el > 1;
+    });
+    auto res = sl::ranges::emplace_to_vector(sl::ranges::prefetch(std::move(filtered), 2));
+    slassert(3 == res.size());
+    slassert(4 == res[2]);
+}
+
+void test_capacity_too_large() {
+    auto vec = std::vector<int>{1, 2, 3};
+    bool thrown = false;
+    try {
+        sl::ranges::prefetch(std::move(vec), static_cast<std::size_t>(-1));
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_order();
+        test_move_only();
+        test_lvalue();
+        test_exception();
+        test_early_stop();
+        test_slow_producer();
+        test_capacity_too_large();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -23,8 +23,10 @@
 
 #include "staticlib/ranges/range_utils.hpp"
 
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
@@ -158,6 +160,216 @@ void test_find() {
     slassert(41 == res3.get().get_val());  
 }
 
+class counting_dest {
+public:
+    using value_type = my_movable;
+    
+    std::vector<my_movable> data;
+    int inserts = 0;
+
+    std::vector<my_movable>::iterator end() {
+        return data.end();
+    }
+
+    template<typename It>
+    void insert(std::vector<my_movable>::iterator pos, It first, It last) {
+        inserts += 1;
+        data.insert(pos, first, last);
+    }
+};
+
+class throwing_dest {
+public:
+    using value_type = my_movable;
+
+    std::vector<my_movable> data;
+
+    std::vector<my_movable>::iterator end() {
+        return data.end();
+    }
+
+    template<typename It>
+    void insert(std::vector<my_movable>::iterator, It, It) {
+        throw std::bad_alloc();
+    }
+};
+
+void test_offcast_into() {
+    auto offcasted = std::vector<my_movable>();
+    auto dest = sl::ranges::offcast_into(offcasted);
+    dest(my_movable(42));
+    slassert(1 == offcasted.size());
+    // still convertible to std::function
+    std::function<void(my_movable)> fun = sl::ranges::offcast_into(offcasted);
+    fun(my_movable(43));
+    slassert(2 == offcasted.size());
+    slassert(43 == offcasted[1].get_val());
+}
+
+void test_offcast_batch() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(i);
+    }
+    auto cd = counting_dest();
+    {
+        auto filtered = sl::ranges::filter(std::move(vec), [](my_movable& el) {
+            return 0 == el.get_val() % 5;
+        }, sl::ranges::offcast_batched_into<3>(cd));
+        auto res = sl::ranges::emplace_to_vector(std::move(filtered));
+        slassert(2 == res.size());
+        // flushed when source is exhausted
+        slassert(3 == cd.inserts);
+        slassert(8 == cd.data.size());
+    }
+    slassert(3 == cd.inserts);
+    slassert(8 == cd.data.size());
+    slassert(1 == cd.data[0].get_val());
+    slassert(9 == cd.data[7].get_val());
+
+    auto offcasted = std::vector<my_movable>();
+    auto batch = sl::ranges::offcast_batch<std::vector<my_movable>, 4>(offcasted);
+    auto vec2 = std::vector<my_movable>();
+    for (int i = 0; i < 6; i++) {
+        vec2.emplace_back(i);
+    }
+    auto filtered = sl::ranges::filter(std::move(vec2), [](my_movable&) {
+        return false;
+    }, std::ref(batch));
+    auto res = sl::ranges::emplace_to_vector(std::move(filtered));
+    slassert(0 == res.size());
+    slassert(4 == offcasted.size());
+    slassert(2 == batch.size());
+    batch.flush();
+    slassert(6 == offcasted.size());
+    slassert(0 == batch.size());
+
+    // iterator-based pass flushes too
+    auto cd_iter = counting_dest();
+    auto vec3 = std::vector<my_movable>();
+    for (int i = 0; i < 5; i++) {
+        vec3.emplace_back(i);
+    }
+    auto filtered_iter = sl::ranges::filter(std::move(vec3), [](my_movable& el) {
+        return 0 == el.get_val();
+    }, sl::ranges::offcast_batched_into<3>(cd_iter));
+    auto count = 0;
+    for (auto el : filtered_iter) {
+        (void) el;
+        count += 1;
+    }
+    slassert(1 == count);
+    slassert(4 == cd_iter.data.size());
+
+    // failed flush from destructor does not terminate
+    auto td = throwing_dest();
+    {
+        auto failing = sl::ranges::offcast_batch<throwing_dest, 4>(td);
+        failing(my_movable(42));
+    }
+    bool thrown = false;
+    try {
+        auto failing = sl::ranges::offcast_batch<throwing_dest, 4>(td);
+        failing(my_movable(42));
+        failing.flush();
+    } catch (const std::bad_alloc&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_reductions() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 1; i <= 10; i++) {
+        vec.emplace_back(i);
+    }
+    auto transformed = sl::ranges::transform(sl::ranges::refwrap(vec), [](my_movable& el) {
+        return el.get_val();
+    });
+    auto filtered = sl::ranges::filter(std::move(transformed), [](int el) {
+        return 0 == el % 2;
+    });
+    auto folded = sl::ranges::fold(filtered, std::string(), [](std::string&& acc, int el) {
+        return acc + sl::support::to_string(el);
+    });
+    slassert("246810" == folded);
+
+    auto ints = std::vector<int>{3, 1, 4, 1, 5, 9, 2, 6};
+    slassert(31 == sl::ranges::sum(ints));
+    auto rints = sl::ranges::refwrap(ints);
+    slassert(31 == sl::ranges::sum(rints));
+    slassert(8 == sl::ranges::count(ints));
+    slassert(2 == sl::ranges::count(ints, [](int el) {
+        return 1 == el;
+    }));
+    slassert(1 == sl::ranges::min_element(ints, -1));
+    slassert(9 == sl::ranges::max_element(ints, -1));
+    slassert(1 == sl::ranges::max_element(ints, -1, [](int a, int b) {
+        return a > b;
+    }));
+    auto empty = std::vector<int>();
+    slassert(-1 == sl::ranges::min_element(empty, -1));
+    slassert(0 == sl::ranges::sum(empty));
+    slassert(0 == sl::ranges::count(empty));
+
+    // the first of equal elements is returned
+    auto pairs = std::vector<std::pair<int, int>>{{2, 0}, {1, 1}, {3, 2}, {1, 3}, {3, 4}};
+    auto by_first = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+    };
+    slassert(1 == sl::ranges::min_element(pairs, std::make_pair(0, -1), by_first).second);
+    slassert(2 == sl::ranges::max_element(pairs, std::make_pair(0, -1), by_first).second);
+
+    // elements of the containers are not moved from
+    auto strings = std::vector<std::string>{"bb_long_enough_to_be_allocated",
+            "aa_long_enough_to_be_allocated", "cc_long_enough_to_be_allocated"};
+    auto strings_copy = strings;
+    slassert(3 == sl::ranges::count(strings));
+    slassert("aa_long_enough_to_be_allocated" == sl::ranges::min_element(strings, std::string()));
+    slassert("cc_long_enough_to_be_allocated" == sl::ranges::max_element(strings, std::string()));
+    slassert(strings_copy == strings);
+
+    // move-only elements
+    auto movables = std::vector<my_movable>();
+    movables.emplace_back(2);
+    movables.emplace_back(7);
+    movables.emplace_back(5);
+    auto moved = sl::ranges::transform(std::move(movables), [](my_movable el) {
+        return el;
+    });
+    auto largest = sl::ranges::max_element(moved, my_movable(-1), [](const my_movable& a, const my_movable& b) {
+        return a.get_val() < b.get_val();
+    });
+    slassert(7 == largest.get_val());
+}
+
+void test_allocator() {
+    auto vec = std::vector<my_movable>();
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+    vec.emplace_back(3);
+    auto alloc = my_counting_allocator<char>();
+    auto res = sl::ranges::emplace_to_vector(sl::ranges::transform(std::move(vec), [](my_movable el) {
+        return my_movable(el.get_val() * 2);
+    }), alloc);
+    slassert(3 == res.size());
+    slassert(6 == res[2].get_val());
+    // single allocation reserved with size hint
+    slassert(1 == *alloc.allocations);
+
+#ifdef STATICLIB_RANGES_PMR
+    char space[1024];
+    std::pmr::monotonic_buffer_resource arena(space, sizeof(space), std::pmr::null_memory_resource());
+    auto ints = std::vector<int>{1, 2, 3, 4};
+    auto pres = sl::ranges::emplace_to_vector(sl::ranges::filter(std::move(ints), [](int el) {
+        return 0 == el % 2;
+    }), std::addressof(arena));
+    slassert(2 == pres.size());
+    slassert(4 == pres[1]);
+    slassert(std::addressof(arena) == pres.get_allocator().resource());
+#endif // STATICLIB_RANGES_PMR
+}
+
 int main() {
     try {
         test_vector();
@@ -165,6 +377,10 @@ int main() {
         test_emplace_to();
         test_any();
         test_find();
+        test_offcast_into();
+        test_offcast_batch();
+        test_allocator();
+        test_reductions();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
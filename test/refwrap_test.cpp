@@ -23,11 +23,15 @@
 
 #include "staticlib/ranges/refwrap.hpp"
 
+#include <algorithm>
 #include <array>
+#include <forward_list>
+#include <iterator>
 #include <iostream>
 #include <list>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "staticlib/config/assert.hpp"
@@ -132,12 +136,64 @@ void test_const_ref() {
     auto res = filtered.to_vector();
 }
 
+void test_iterator_category() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(i * 10);
+    }
+    auto refwrapped = sl::ranges::refwrap(vec);
+    using iter_type = decltype(refwrapped.begin());
+    // elements are returned by value, multi-pass traversal is reported separately
+    static_assert(std::is_same<std::input_iterator_tag,
+            std::iterator_traits<iter_type>::iterator_category>::value, "input");
+    static_assert(std::is_same<std::random_access_iterator_tag,
+            sl::ranges::iterator_traversal<iter_type>::type>::value, "random access");
+    auto begin = refwrapped.begin();
+    auto end = refwrapped.end();
+    slassert(10 == std::distance(begin, end));
+    slassert(30 == begin[3].get().get_val());
+    auto it = begin;
+    it += 5;
+    slassert(50 == (*it).get().get_val());
+    slassert(5 == it - begin);
+    slassert(begin < it);
+    slassert(40 == (*(it - 1)).get().get_val());
+    slassert(60 == (*(1 + it)).get().get_val());
+    slassert(50 == (*it--).get().get_val());
+    slassert(40 == (*it).get().get_val());
+    slassert(end > it);
+    slassert(70 == (*(end - 3)).get().get_val());
+    // elements are not moved from
+    slassert(70 == vec[7].get_val());
+
+    const auto& cvec = vec;
+    auto crefwrapped = sl::ranges::refwrap(cvec);
+    auto cbegin = crefwrapped.begin();
+    slassert(90 == cbegin[9].get().get_val());
+    slassert(10 == std::distance(cbegin, crefwrapped.end()));
+
+    auto li = std::list<int>{1, 2, 3};
+    auto lrefwrapped = sl::ranges::refwrap(li);
+    static_assert(std::is_same<std::bidirectional_iterator_tag,
+            sl::ranges::iterator_traversal<decltype(lrefwrapped.begin())>::type>::value, "bidirectional");
+    auto lend = lrefwrapped.end();
+    --lend;
+    slassert(3 == (*lend).get());
+
+    auto fli = std::forward_list<int>{1, 2, 3};
+    auto frefwrapped = sl::ranges::refwrap(fli);
+    static_assert(std::is_same<std::forward_iterator_tag,
+            sl::ranges::iterator_traversal<decltype(frefwrapped.begin())>::type>::value, "forward");
+    slassert(3 == std::distance(frefwrapped.begin(), frefwrapped.end()));
+}
+
 int main() {
     try {
         test_state_after_move();
         test_transform_refwrapped();
         test_refwrap_to_value();
         test_const_ref();
+        test_iterator_category();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   size_hint_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 10:40 AM
+ */
+
+#include "staticlib/ranges/size_hint.hpp"
+
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/concat.hpp"
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/refwrap.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_containers() {
+    std::vector<int> vec{1, 2, 3};
+    auto vh = sl::ranges::get_size_hint(vec);
+    slassert(vh.is_exact());
+    slassert(3 == vh.value());
+
+    std::list<int> li{1, 2};
+    auto lh = sl::ranges::get_size_hint(li);
+    slassert(lh.is_exact());
+    slassert(2 == lh.value());
+
+    std::forward_list<int> fli{1, 2};
+    auto fh = sl::ranges::get_size_hint(fli);
+    slassert(!fh.is_known());
+
+    auto ah = sl::ranges::get_size_hint(my_counting_range(3));
+    slassert(!ah.is_known());
+}
+
+void test_combined() {
+    std::vector<my_movable> vec{};
+    vec.emplace_back(41);
+    vec.emplace_back(42);
+    vec.emplace_back(43);
+    std::list<my_movable> li{};
+    li.emplace_back(91);
+
+    auto transformed = sl::ranges::transform(vec, [](my_movable& el) {
+        return el.get_val();
+    });
+    auto th = transformed.get_size_hint();
+    slassert(th.is_exact());
+    slassert(3 == th.value());
+
+    auto filtered = sl::ranges::filter(vec, [](my_movable& el) {
+        return 42 != el.get_val();
+    });
+    auto fh = filtered.get_size_hint();
+    slassert(sl::ranges::size_hint::kind::UPPER_BOUND == fh.get_kind());
+    slassert(3 == fh.value());
+
+    auto concatted = sl::ranges::concat(vec, li);
+    auto ch = concatted.get_size_hint();
+    slassert(ch.is_exact());
+    slassert(4 == ch.value());
+
+    auto refwrapped = sl::ranges::refwrap(li);
+    auto concatted_filtered = sl::ranges::concat(filtered, refwrapped);
+    auto cfh = concatted_filtered.get_size_hint();
+    slassert(sl::ranges::size_hint::kind::UPPER_BOUND == cfh.get_kind());
+    slassert(4 == cfh.value());
+
+    auto concatted_adapter = sl::ranges::concat(sl::ranges::transform(vec, [](my_movable& el) {
+        return my_movable(el.get_val());
+    }), my_counting_range(2));
+    slassert(!concatted_adapter.get_size_hint().is_known());
+}
+
+void test_reserve() {
+    std::vector<my_movable> vec{};
+    for (int i = 0; i < 100; i++) {
+        vec.emplace_back(i);
+    }
+
+    auto transformed = sl::ranges::transform(vec, [](my_movable& el) {
+        return el.get_val();
+    });
+    auto res = transformed.to_vector();
+    slassert(100 == res.size());
+    slassert(100 == res.capacity());
+
+    auto filtered = sl::ranges::filter(vec, [](my_movable& el) {
+        return el.get_val() < 10;
+    });
+    auto fres = sl::ranges::emplace_to_vector(std::move(filtered));
+    slassert(10 == fres.size());
+    slassert(0 == fres[0].get().get_val());
+    slassert(9 == fres[9].get().get_val());
+
+    // upper bound of a selective filter is not reserved in full
+    auto large = std::vector<int>();
+    for (int i = 0; i < 100000; i++) {
+        large.push_back(i);
+    }
+    auto selective = sl::ranges::filter(large, [](int el) {
+        return 0 == el % 10000;
+    });
+    auto sres = sl::ranges::emplace_to_vector(std::move(selective));
+    slassert(10 == sres.size());
+    slassert(90000 == sres[9].get());
+    slassert(sres.capacity() < large.size());
+
+    auto dest = std::vector<int>{};
+    dest.reserve(4);
+    dest.push_back(-1);
+    sl::ranges::emplace_to(dest, sl::ranges::transform(vec, [](my_movable& el) {
+        return el.get_val();
+    }));
+    slassert(101 == dest.size());
+    slassert(101 == dest.capacity());
+}
+
+int main() {
+    try {
+        test_containers();
+        test_combined();
+        test_reserve();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
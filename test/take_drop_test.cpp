@@ -0,0 +1,260 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   take_drop_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 5:30 PM
+ */
+
+#include "staticlib/ranges/take_drop.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/fusion.hpp"
+#include "staticlib/ranges/parallel.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_take_lazy() {
+    int calls = 0;
+    auto range = sl::ranges::take(my_calls_counting_range(100, calls), 3);
+    slassert(0 == calls);
+    slassert(3 == range.get_size_hint().value());
+    slassert(!range.get_size_hint().is_exact());
+    auto res = std::vector<int>();
+    for (auto el : range) {
+        res.push_back(el.get_val());
+    }
+    slassert(3 == res.size());
+    slassert(0 == res[0]);
+    slassert(2 == res[2]);
+    // no upstream work after the last taken element
+    slassert(3 == calls);
+
+    int calls_zero = 0;
+    auto empty = sl::ranges::take(my_calls_counting_range(100, calls_zero), 0);
+    slassert(0 == sl::ranges::emplace_to_vector(std::move(empty)).size());
+    slassert(0 == calls_zero);
+
+    int calls_short = 0;
+    auto all = sl::ranges::take(my_calls_counting_range(2, calls_short), 5);
+    slassert(2 == sl::ranges::emplace_to_vector(std::move(all)).size());
+    slassert(3 == calls_short);
+}
+
+void test_take_fused() {
+    int calls = 0;
+    auto range = sl::ranges::take(my_calls_counting_range(100, calls), 5);
+    auto sum = 0;
+    auto sink = [&sum](my_movable el) {
+        sum += el.get_val();
+        return true;
+    };
+    bool res = sl::ranges::fused_for_each(range, sink);
+    slassert(res);
+    slassert(10 == sum);
+    slassert(5 == calls);
+
+    int calls_stop = 0;
+    auto stopped = sl::ranges::take(my_calls_counting_range(100, calls_stop), 5);
+    auto count = 0;
+    auto stopping_sink = [&count](my_movable) {
+        count += 1;
+        return count < 2;
+    };
+    bool res_stop = sl::ranges::fused_for_each(stopped, stopping_sink);
+    slassert(!res_stop);
+    slassert(2 == count);
+    slassert(2 == calls_stop);
+}
+
+void test_take_vector() {
+    auto vec = std::vector<int>{1, 2, 3, 4, 5};
+    auto range = sl::ranges::take(vec, 3);
+    slassert(3 == range.size());
+    slassert(range.get_size_hint().is_exact());
+    auto res = std::vector<int>();
+    for (auto el : range) {
+        res.push_back(el.get());
+    }
+    auto expected = std::vector<int>{1, 2, 3};
+    slassert(expected == res);
+
+    auto over = sl::ranges::take(std::move(vec), 42);
+    slassert(5 == over.size());
+}
+
+void test_drop_vector() {
+    std::atomic<int> count{0};
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    // dropped elements are never transformed
+    auto transformed = sl::ranges::transform(vec, [&count](int& el) {
+        count += 1;
+        return el * 2;
+    });
+    auto dropped = sl::ranges::drop(std::move(transformed), 990);
+    slassert(10 == dropped.size());
+    slassert(10 == dropped.get_size_hint().value());
+    auto res = std::vector<int>();
+    for (auto el : dropped) {
+        res.push_back(el);
+    }
+    slassert(10 == res.size());
+    slassert(1980 == res[0]);
+    slassert(1998 == res[9]);
+    slassert(10 == count);
+
+    auto over = sl::ranges::drop(vec, 1001);
+    slassert(0 == over.size());
+    slassert(!(over.begin() != over.end()));
+}
+
+void test_slice_parallel() {
+    auto vec = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+    }
+    auto slice = sl::ranges::take(sl::ranges::drop(std::move(vec), 100), 500);
+    auto transformed = sl::ranges::transform(std::move(slice), [](int el) {
+        return el + 1;
+    });
+    auto res = transformed.to_vector(sl::ranges::parallel_policy{4, 10});
+    slassert(500 == res.size());
+    slassert(101 == res[0]);
+    slassert(600 == res[499]);
+}
+
+void test_drop() {
+    int calls = 0;
+    auto range = sl::ranges::drop(my_calls_counting_range(10, calls), 7);
+    slassert(0 == calls);
+    auto res = sl::ranges::emplace_to_vector(std::move(range));
+    slassert(3 == res.size());
+    slassert(7 == res[0].get_val());
+    slassert(9 == res[2].get_val());
+
+    int calls_fused = 0;
+    auto fused = sl::ranges::drop(my_calls_counting_range(10, calls_fused), 8);
+    auto sum = 0;
+    auto sink = [&sum](my_movable el) {
+        sum += el.get_val();
+        return true;
+    };
+    sl::ranges::fused_for_each(fused, sink);
+    slassert(17 == sum);
+
+    int calls_over = 0;
+    auto over = sl::ranges::drop(my_calls_counting_range(3, calls_over), 5);
+    slassert(0 == sl::ranges::emplace_to_vector(std::move(over)).size());
+
+    // size hint does not change once iteration is started
+    auto li = sl::ranges::drop(std::list<int>{1, 2, 3, 4, 5}, 2);
+    slassert(3 == li.get_size_hint().value());
+    auto it = li.begin();
+    slassert(3 == *it);
+    slassert(3 == li.get_size_hint().value());
+    slassert(li.get_size_hint().is_exact());
+}
+
+void test_take_while() {
+    int calls = 0;
+    auto range = sl::ranges::take_while(my_calls_counting_range(100, calls), [](my_movable& el) {
+        return el.get_val() < 4;
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(range));
+    slassert(4 == res.size());
+    slassert(3 == res[3].get_val());
+    // first not matching element is the last one pulled
+    slassert(5 == calls);
+
+    int calls_fused = 0;
+    auto fused = sl::ranges::take_while(my_calls_counting_range(100, calls_fused), [](my_movable& el) {
+        return el.get_val() < 4;
+    });
+    auto sum = 0;
+    auto sink = [&sum](my_movable el) {
+        sum += el.get_val();
+        return true;
+    };
+    bool fused_res = sl::ranges::fused_for_each(fused, sink);
+    slassert(fused_res);
+    slassert(6 == sum);
+    slassert(5 == calls_fused);
+
+    auto vec = std::vector<int>{1, 2, 3};
+    auto all = sl::ranges::take_while(vec, [](int) {
+        return true;
+    });
+    slassert(3 == all.get_size_hint().value());
+    slassert(!all.get_size_hint().is_exact());
+}
+
+void test_drop_while() {
+    auto vec = std::vector<int>{1, 2, 5, 1, 7};
+    auto range = sl::ranges::drop_while(std::move(vec), [](int el) {
+        return el < 3;
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(range));
+    auto expected = std::vector<int>{5, 1, 7};
+    slassert(expected == res);
+
+    int calls = 0;
+    auto fused = sl::ranges::drop_while(my_calls_counting_range(10, calls), [](my_movable& el) {
+        return el.get_val() < 8;
+    });
+    auto sum = 0;
+    auto sink = [&sum](my_movable el) {
+        sum += el.get_val();
+        return true;
+    };
+    sl::ranges::fused_for_each(fused, sink);
+    slassert(17 == sum);
+
+    auto none = sl::ranges::drop_while(std::vector<int>{1, 2}, [](int) {
+        return true;
+    });
+    slassert(0 == sl::ranges::emplace_to_vector(std::move(none)).size());
+}
+
+int main() {
+    try {
+        test_take_lazy();
+        test_take_fused();
+        test_take_vector();
+        test_drop_vector();
+        test_slice_parallel();
+        test_drop();
+        test_take_while();
+        test_drop_while();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   transform_batch_test.cpp
+ * Author: alex
+ *
+ * Created on October 16, 2026, 6:20 PM
+ */
+
+#include "staticlib/ranges/transform_batch.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+void test_iterate() {
+    auto vec = std::vector<float>();
+    for (int i = 0; i < 10; i++) {
+        vec.push_back(static_cast<float>(i));
+    }
+    auto calls = 0;
+    auto kernel = [&calls](const float* in, size_t n, float* out) {
+        calls += 1;
+        sl::ranges::batch_multiply(2.0f)(in, n, out);
+    };
+    auto range = sl::ranges::transform_batch(vec, kernel, 4);
+    slassert(10 == range.get_size_hint().value());
+    auto res = std::vector<float>();
+    for (float el : range) {
+        res.push_back(el);
+    }
+    slassert(3 == calls);
+    slassert(10 == res.size());
+    for (size_t i = 0; i < res.size(); i++) {
+        slassert(vec[i] * 2.0f == res[i]);
+    }
+
+    auto empty = std::vector<float>();
+    auto count = 0;
+    for (float el : sl::ranges::transform_batch(empty, sl::ranges::batch_add(1.0f))) {
+        (void) el;
+        count += 1;
+    }
+    slassert(0 == count);
+}
+
+void test_to_vector() {
+    auto vec = std::vector<int32_t>();
+    for (int i = 0; i < 5000; i++) {
+        vec.push_back(i);
+    }
+    auto calls = 0;
+    auto kernel = [&calls](const int32_t* in, size_t n, int32_t* out) {
+        calls += 1;
+        sl::ranges::batch_add(int32_t(1))(in, n, out);
+    };
+    auto res = sl::ranges::transform_batch(vec, kernel, 16).to_vector();
+    // single kernel call for the whole input
+    slassert(1 == calls);
+    slassert(5000 == res.size());
+    slassert(1 == res[0]);
+    slassert(5000 == res[4999]);
+    // source is not modified
+    slassert(0 == vec[0]);
+
+    auto owned = sl::ranges::transform_batch(std::array<uint64_t, 3>{{1, 2, 3}},
+            sl::ranges::batch_multiply(uint64_t(10))).to_vector();
+    slassert(3 == owned.size());
+    slassert(30 == owned[2]);
+
+    auto alloc = my_counting_allocator<int32_t>();
+    auto allocated = sl::ranges::transform_batch(vec, sl::ranges::batch_add(int32_t(2))).to_vector(alloc);
+    slassert(5000 == allocated.size());
+    slassert(2 == allocated[0]);
+    slassert(1 == *alloc.allocations);
+}
+
+void test_output_type() {
+    auto vec = std::vector<int32_t>{1, 2, 3};
+    auto range = sl::ranges::transform_batch<double>(vec, [](const int32_t* in, size_t n, double* out) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = in[i] / 2.0;
+        }
+    });
+    auto res = range.to_vector();
+    slassert(1.5 == res[2]);
+}
+
+void test_fused() {
+    auto vec = std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    auto batched = sl::ranges::transform_batch(vec, sl::ranges::batch_add(10.0f), 2);
+    auto transformed = sl::ranges::transform(std::move(batched), [](float el) {
+        return static_cast<int>(el);
+    });
+    auto res = sl::ranges::emplace_to_vector(std::move(transformed));
+    slassert(5 == res.size());
+    slassert(11 == res[0]);
+    slassert(15 == res[4]);
+
+    auto batched_any = sl::ranges::transform_batch(vec, sl::ranges::batch_add(10.0f), 2);
+    slassert(sl::ranges::any(batched_any, [](float el) {
+        return 13.0f == el;
+    }));
+}
+
+int main() {
+    try {
+        test_iterate();
+        test_to_vector();
+        test_output_type();
+        test_fused();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -23,11 +23,14 @@
 
 #include "staticlib/ranges/transform.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 #include "staticlib/config/assert.hpp"
@@ -160,6 +163,84 @@ void test_readme() {
     slassert(92 == res[3].get().get_val());
 }
 
+void test_iterator_category() {
+    auto vec = std::vector<my_movable>();
+    for (int i = 0; i < 10; i++) {
+        vec.emplace_back(i);
+    }
+    auto transformed = sl::ranges::transform(vec, [](my_movable& el) {
+        return el.get_val() * 2;
+    });
+    using iter_type = decltype(transformed.begin());
+    // elements are returned by value, multi-pass traversal is reported separately
+    static_assert(std::is_same<std::input_iterator_tag,
+            std::iterator_traits<iter_type>::iterator_category>::value, "input");
+    static_assert(std::is_same<std::random_access_iterator_tag,
+            sl::ranges::iterator_traversal<iter_type>::type>::value, "random access");
+    auto begin = transformed.begin();
+    auto end = transformed.end();
+    slassert(10 == std::distance(begin, end));
+    slassert(14 == begin[7]);
+    auto copy = begin;
+    copy += 2;
+    slassert(4 == *copy);
+    slassert(0 == *begin);
+    slassert(2 == copy - begin);
+    slassert(18 == *(end - 1));
+    slassert(12 == (begin + 6)[0]);
+
+    // traversal is propagated through the refwrap
+    auto wrapped = sl::ranges::transform(sl::ranges::refwrap(vec), [](std::reference_wrapper<my_movable> el) {
+        return el.get().get_val();
+    });
+    static_assert(sl::ranges::is_random_access_iterator<decltype(wrapped.begin())>::value, "random access");
+    slassert(9 == wrapped.begin()[9]);
+
+    // scalar elements are copied into functor
+    auto ints = std::vector<int>{1, 2, 3};
+    auto owned = sl::ranges::transform(std::move(ints), [](int el) {
+        return el + 1;
+    });
+    slassert(3 == std::distance(owned.begin(), owned.end()));
+
+    // moved elements cannot be accessed twice
+    auto strs = std::vector<std::string>{"a", "b"};
+    auto moved = sl::ranges::transform(std::move(strs), [](std::string el) {
+        return el;
+    });
+    using moved_iter_type = decltype(moved.begin());
+    static_assert(std::is_same<std::input_iterator_tag,
+            sl::ranges::iterator_traversal<moved_iter_type>::type>::value, "input");
+}
+
+void test_allocator() {
+    auto vec = std::vector<int>{1, 2, 3};
+    auto alloc = my_counting_allocator<int>();
+    auto res = sl::ranges::transform(vec, [](int el) {
+        return my_movable(el * 10);
+    }).to_vector(alloc);
+    slassert(3 == res.size());
+    slassert(30 == res[2].get_val());
+    slassert(1 == *alloc.allocations);
+
+    auto filtered = sl::ranges::filter(sl::ranges::concat(std::move(vec), std::vector<int>{4, 5}), [](int el) {
+        return el > 2;
+    });
+    auto fres = filtered.to_vector(alloc);
+    slassert(3 == fres.size());
+    slassert(5 == fres[2]);
+
+#ifdef STATICLIB_RANGES_PMR
+    std::pmr::monotonic_buffer_resource arena;
+    auto pres = sl::ranges::transform(std::vector<int>{1, 2}, [](int el) {
+        return el + 1;
+    }).to_vector(std::addressof(arena));
+    slassert(2 == pres.size());
+    slassert(3 == pres[1]);
+    slassert(std::addressof(arena) == pres.get_allocator().resource());
+#endif // STATICLIB_RANGES_PMR
+}
+
 int main() {
     try {
         test_vector();
@@ -167,6 +248,8 @@ int main() {
         test_map();
         test_lvalue();
         test_readme();
+        test_iterator_category();
+        test_allocator();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zip_test.cpp
+ * Author: alex
+ *
+ * Created on October 17, 2026, 7:30 PM
+ */
+
+#include "staticlib/ranges/zip.hpp"
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/ranges/distinct.hpp"
+#include "staticlib/ranges/filter.hpp"
+#include "staticlib/ranges/parallel.hpp"
+#include "staticlib/ranges/range_utils.hpp"
+#include "staticlib/ranges/transform.hpp"
+
+#include "domain_classes.hpp"
+
+struct tuple_hash {
+    std::size_t operator()(const std::tuple<std::size_t, int>& tu) const {
+        return std::get<0>(tu) * 31 + std::hash<int>()(std::get<1>(tu));
+    }
+};
+
+void test_columns() {
+    auto ids = std::vector<int>{1, 2, 3, 4};
+    auto names = std::vector<std::string>{"foo", "bar", "baz"};
+    auto res = std::vector<std::string>();
+    for (auto tu : sl::ranges::zip(ids, names)) {
+        res.push_back(std::get<1>(tu).get() + std::to_string(std::get<0>(tu).get()));
+    }
+    // stops on the shortest
+    slassert(3 == res.size());
+    slassert("foo1" == res[0]);
+    slassert("baz3" == res[2]);
+    // lvalue sources are not moved from
+    slassert("bar" == names[1]);
+}
+
+void test_movable() {
+    int calls = 0;
+    auto vec = std::vector<int>{10, 20, 30};
+    auto zipped = sl::ranges::zip(my_calls_counting_range(100, calls), std::move(vec));
+    slassert(3 == zipped.get_size_hint().value());
+    slassert(!zipped.get_size_hint().is_exact());
+    auto res = std::vector<int>();
+    for (auto tu : zipped) {
+        my_movable el = std::move(std::get<0>(tu));
+        res.push_back(el.get_val() + std::get<1>(tu));
+    }
+    auto expected = std::vector<int>{10, 21, 32};
+    slassert(expected == res);
+    // shorter source is checked after advancing the longer one
+    slassert(4 == calls);
+
+    int calls_short = 0;
+    auto shorter = sl::ranges::zip(my_calls_counting_range(2, calls_short), std::vector<int>{1, 2, 3});
+    slassert(2 == shorter.to_vector().size());
+    slassert(3 == calls_short);
+}
+
+void test_enumerate() {
+    auto vec = std::vector<std::string>{"foo", "bar", "baz"};
+    auto en = sl::ranges::enumerate(vec);
+    slassert(3 == en.get_size_hint().value());
+    slassert(en.get_size_hint().is_exact());
+    auto res = std::vector<std::string>();
+    for (auto tu : en) {
+        res.push_back(std::to_string(std::get<0>(tu)) + std::get<1>(tu).get());
+    }
+    auto expected = std::vector<std::string>{"0foo", "1bar", "2baz"};
+    slassert(expected == res);
+
+    auto empty = sl::ranges::enumerate(std::vector<int>());
+    slassert(0 == empty.to_vector().size());
+}
+
+void test_enumerate_hint() {
+    // index source does not limit the hint of the zipped range
+    auto en = sl::ranges::enumerate(my_counting_range(3));
+    slassert(!en.get_size_hint().is_known());
+    slassert(0 == en.get_size_hint().value());
+    int calls = 0;
+    auto zipped = sl::ranges::zip(sl::ranges::enumerate(std::vector<int>{1, 2}), my_calls_counting_range(5, calls));
+    slassert(2 == zipped.get_size_hint().value());
+    slassert(!zipped.get_size_hint().is_exact());
+    // reservation from the hint must terminate
+    auto res = sl::ranges::emplace_to_vector(sl::ranges::distinct(
+            sl::ranges::enumerate(sl::ranges::transform(my_counting_range(3), [](my_movable el) {
+        return el.get_val();
+    })), tuple_hash(), std::equal_to<std::tuple<std::size_t, int>>()));
+    slassert(3 == res.size());
+    slassert(2 == std::get<0>(res[2]));
+    slassert(3 == std::get<1>(res[2]));
+}
+
+void test_chain() {
+    auto prices = std::vector<int>{10, 20, 30, 40};
+    auto counts = std::vector<int>{1, 0, 2, 3};
+    auto zipped = sl::ranges::zip(prices, counts);
+    auto filtered = sl::ranges::filter(std::move(zipped), [](const std::tuple<std::reference_wrapper<int>,
+            std::reference_wrapper<int>>& tu) {
+        return std::get<1>(tu).get() > 0;
+    }, sl::ranges::ignore_offcast<std::tuple<std::reference_wrapper<int>, std::reference_wrapper<int>>>);
+    auto totals = sl::ranges::transform(std::move(filtered), [](std::tuple<std::reference_wrapper<int>,
+            std::reference_wrapper<int>> tu) {
+        return std::get<0>(tu).get() * std::get<1>(tu).get();
+    });
+    auto res = totals.to_vector();
+    auto expected = std::vector<int>{10, 60, 120};
+    slassert(expected == res);
+}
+
+void test_parallel() {
+    auto xs = std::vector<int>();
+    auto ys = std::vector<int>();
+    for (int i = 0; i < 1000; i++) {
+        xs.push_back(i);
+        ys.push_back(i * 10);
+    }
+    auto zipped = sl::ranges::zip(xs, ys);
+    slassert(sl::ranges::detail_fusion::is_sliceable<decltype(zipped)>::value);
+    slassert(1000 == sl::ranges::detail_fusion::get_slice_size(zipped));
+    auto sums = sl::ranges::transform(std::move(zipped), [](std::tuple<std::reference_wrapper<int>,
+            std::reference_wrapper<int>> tu) {
+        return std::get<0>(tu).get() + std::get<1>(tu).get();
+    });
+    auto res = sums.to_vector(sl::ranges::parallel_policy{4, 10});
+    slassert(1000 == res.size());
+    slassert(0 == res[0]);
+    slassert(11 * 999 == res[999]);
+
+    auto en = sl::ranges::enumerate(std::move(ys));
+    slassert(sl::ranges::detail_fusion::is_sliceable<decltype(en)>::value);
+    auto indices = sl::ranges::transform(std::move(en), [](std::tuple<std::size_t, int> tu) {
+        return static_cast<int>(std::get<0>(tu)) * 10 - std::get<1>(tu);
+    });
+    auto diffs = indices.to_vector(sl::ranges::parallel_policy{4, 10});
+    slassert(1000 == diffs.size());
+    for (int diff : diffs) {
+        slassert(0 == diff);
+    }
+}
+
+int main() {
+    try {
+        test_columns();
+        test_movable();
+        test_enumerate();
+        test_enumerate_hint();
+        test_chain();
+        test_parallel();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}